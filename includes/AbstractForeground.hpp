@@ -28,17 +28,13 @@
 
 #include <memory>
 
-namespace sf
-{
-class RenderWindow;
-}
-
 namespace memoris
 {
 
 namespace utils
 {
 class Context;
+class ProfiledWindow;
 }
 
 namespace foregrounds
@@ -54,7 +50,7 @@ protected:
      *
      * @param window the SFML window to use
      */
-    AbstractForeground(sf::RenderWindow& window);
+    AbstractForeground(utils::ProfiledWindow& window);
 
     AbstractForeground(const AbstractForeground&) = delete;
 
@@ -68,9 +64,9 @@ protected:
     /**
      * @brief context getter
      *
-     * @return sf::RenderWindow&
+     * @return utils::ProfiledWindow&
      */
-    sf::RenderWindow& getWindow() const & noexcept;
+    utils::ProfiledWindow& getWindow() const & noexcept;
 
     /**
      * @brief renders the foreground in front of the controller screen
@@ -42,6 +42,15 @@ namespace controllers
 class AbstractMenuController : public Controller
 {
 
+public:
+
+    /**
+     * @brief resets the controller and selects the first menu item
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    virtual void reset() const & override;
+
 protected:
 
     /**
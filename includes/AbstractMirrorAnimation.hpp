@@ -85,6 +85,23 @@ protected:
      */
     void applyTransparencyOnOneCell(const unsigned short& index) const &;
 
+    /**
+     * @brief applies the exact transparency of the previous step on the
+     * cells that were interpolated, called before playing every step
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void startTransparencyStep() const &;
+
+    /**
+     * @brief applies on the cells of the current step a transparency
+     * interpolated between the previous one and the current one, according
+     * to the progression of the step; called once per frame after the steps
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void interpolateTransparency() const &;
+
 private:
 
     class Impl;
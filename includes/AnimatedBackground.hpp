@@ -28,6 +28,14 @@
 
 #include <memory>
 
+namespace sf
+{
+template<typename T>
+class Rect;
+
+typedef Rect<int> IntRect;
+}
+
 namespace memoris
 {
 
@@ -61,7 +69,8 @@ public:
     ~AnimatedBackground();
 
     /**
-     * @brief render the animated background, display all the cells
+     * @brief scrolls the animated background according to the elapsed
+     * time and displays all the cells
      *
      * utils::Context::getClockMillisecondsTime() and others SFML methods 
      * are not noexcept
@@ -73,10 +82,25 @@ private:
     /**
      * @brief initialize every cells of the animated background
      *
-     * entities::Cell constructor is not noexcept as it calls SFML methods
+     * sf::VertexArray::append() is not noexcept
      */
     void initializeCells() const &;
 
+    /**
+     * @brief appends the quad of one cell into the background vertices
+     *
+     * @param horizontalPosition the horizontal position of the cell
+     * @param verticalPosition the vertical position of the cell
+     * @param rect the area of the cell picture into the cells atlas
+     *
+     * sf::VertexArray::append() is not noexcept
+     */
+    void appendCell(
+        const float& horizontalPosition,
+        const float& verticalPosition,
+        const sf::IntRect& rect
+    ) const &;
+
     /**
      * @brief returns a random cell type or return 0
      *
@@ -0,0 +1,127 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * @file AudioMixer.hpp
+ * @brief plays the sounds effects on a fixed pool of voices; the same
+ * effect can be played several times at once, the less important voices
+ * are stopped when too many voices are playing
+ * @package sounds
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_AUDIOMIXER_H_
+#define MEMORIS_AUDIOMIXER_H_
+
+#include <memory>
+#include <vector>
+
+namespace memoris
+{
+
+namespace utils
+{
+class ResourcesLoader;
+}
+
+namespace sounds
+{
+
+enum class SoundId;
+
+class AudioMixer
+{
+
+public:
+
+    /**
+     * @brief constructor, no sound is decoded until it is expected by a
+     * controller
+     *
+     * @param loader the loader of the packed resources
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    AudioMixer(const utils::ResourcesLoader& loader);
+
+    AudioMixer(const AudioMixer&) = delete;
+
+    AudioMixer& operator=(const AudioMixer&) = delete;
+
+    /**
+     * @brief default destructor
+     */
+    ~AudioMixer();
+
+    /**
+     * @brief starts the given sound on one of its free voices, or on its
+     * oldest voice if they are all playing; if too many voices are playing,
+     * the oldest voice with the lowest priority is stopped, the sound is
+     * not played if every playing voice has a higher priority; only the
+     * sounds expected by the current controller are decoded (see
+     * preload()), any other sound is not played; this method never
+     * allocates memory and never waits for the sound
+     *
+     * @param id the sound to play
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void play(const SoundId& id) const &;
+
+    /**
+     * @brief releases the decoded sounds that are not expected anymore and
+     * not playing, then decodes the expected sounds that are not decoded
+     * yet; called before the creation of every controller, so the sounds
+     * are not decoded during the game
+     *
+     * @param expectedSounds the sounds that may be played
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void preload(const std::vector<SoundId>& expectedSounds) const &;
+
+private:
+
+    /**
+     * @brief decodes one packed sound and binds its voices to the decoded
+     * buffer; a sound that is not into the pack or that cannot be decoded
+     * is never decoded again and never played, the game can still run
+     *
+     * @param sound the index of the sound
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void loadSound(const std::size_t& sound) const &;
+
+    /**
+     * @brief unbinds the voices of one sound and releases its buffer,
+     * if none of its voices is playing
+     *
+     * @param sound the index of the sound
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void releaseSound(const std::size_t& sound) const &;
+
+    class Impl;
+    const std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
@@ -64,7 +64,8 @@ public:
      * @param context the current context
      * @param hPosition horizontal position of the button
      * @param vPosition vertical position of the button
-     * @param texture reference to the SFML texture of the icon
+     * @param texture the SFML texture of the icon, kept as long as the
+     * button exists
      *
      * @throw std::bad_alloc the implementation cannot be initialized;
      * this exception is never caught and the program terminates
@@ -73,7 +74,7 @@ public:
         const utils::Context& context,
         const float& hPosition,
         const float& vPosition,
-        const sf::Texture& texture
+        const std::shared_ptr<const sf::Texture>& texture
     );
 
     Button(const Button&) = delete;
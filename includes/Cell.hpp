@@ -98,13 +98,6 @@ public:
      */
     ~Cell();
 
-    /**
-     * @brief move the cell to one pixel on the right (used by menu animation)
-     *
-     * not noexcept because it calls SFML methods that are not noexcept
-     */
-    void moveHorizontally() const &;
-
     /**
      * @brief move the cells into the given direction (used by animation)
      *
@@ -156,10 +149,15 @@ public:
      * @brief displays the cell and highlights it when the mouse is hover
      *
      * @param context the context to use
+     * @param isMouseHover true if the mouse is hover the cell, computed
+     * once for the whole cells grid by the caller
      *
      * not noexcept because it calls SFML methods that are not noexcept
      */
-    void displayWithMouseHover(const utils::Context& context) const &;
+    void displayWithMouseHover(
+        const utils::Context& context,
+        const bool& isMouseHover
+    ) const &;
 
     /**
      * @brief hide the cell, the sprite is replaced by the hidden cell texture
@@ -238,15 +236,6 @@ public:
      */
     void setIsVisible(const bool& visibility) const & noexcept;
 
-    /**
-     * @brief indicates if the mouse is currently hover this cell
-     *
-     * @return const bool
-     *
-     * not noexcept because it calls SFML functions that are not noexcept
-     */
-    const bool isMouseHover() const &;
-
     /**
      * @brief reset the graphical position of the cell to the original one
      *
@@ -31,10 +31,22 @@
 namespace sf
 {
 class Texture;
+class Image;
+
+template<typename T>
+class Rect;
+
+typedef Rect<int> IntRect;
 };
 
 namespace memoris
 {
+
+namespace utils
+{
+class ResourcesLoader;
+}
+
 namespace managers
 {
 
@@ -44,13 +56,16 @@ class CellsTexturesManager
 public:
 
     /**
-     * @brief constructor, loads each texture one by one,
-     * throws an exception if the texture cannot be loaded
+     * @brief constructor, decodes every cell picture in parallel and copies
+     * them into one unique atlas texture, throws an exception if one
+     * picture cannot be loaded
+     *
+     * @param loader the loader of the packed pictures
      *
      * @throw std::invalid_argument if one of the image cannot be loaded, an
      * exception is thrown and never caught to let the program stops
      */
-    CellsTexturesManager();
+    CellsTexturesManager(const utils::ResourcesLoader& loader);
 
     CellsTexturesManager(const CellsTexturesManager& other) = delete;
 
@@ -64,32 +79,43 @@ public:
     ~CellsTexturesManager();
 
     /**
-     * @brief returns a texture reference corresponding to the given cell type
-     *
-     * @param type the type of the cell to get
+     * @brief returns the texture containing all the cells pictures
+     * (atlas); any mix of cells types can be rendered with this texture
      *
      * @return const sf::Texture&
      */
-    const sf::Texture& getTextureReferenceByCellType(const char& type) const &
-    noexcept ;
+    const sf::Texture& getAtlasTexture() const & noexcept;
+
+    /**
+     * @brief returns the area of the atlas texture that contains
+     * the picture of the given cell type; unknown types get the
+     * empty cell picture
+     *
+     * @param type the type of the cell
+     *
+     * @return const sf::IntRect
+     */
+    const sf::IntRect getAtlasTextureRectByCellType(const char& type) const &
+        noexcept;
 
 private:
 
     /**
-     * @brief load a texture from the textures folder
+     * @brief copies a decoded cell picture into the atlas image at the
+     * position of the given cell type
      *
-     * @param texture the SFML texture object that has to be set
-     * @param path file path of the *.png picture to load
+     * @param atlas the atlas image to fill
+     * @param picture the decoded cell picture
+     * @param type the type of the cell of the picture
      *
-     * @throw std::invalid_argument the given file cannot be opened; the
-     * exception is not caught in order to close the program directly if at
-     * least one texture cannot be loaded
+     * not const because it is only called by the constructor
      *
-     * not const because modifies the textures of the object
+     * not noexcept because it calls SFML methods that are not noexcept
      */
-    void loadTexture(
-        sf::Texture& texture,
-        const std::string& path
+    void copyPicture(
+        sf::Image& atlas,
+        const sf::Image& picture,
+        const char& type
     ) &;
 
     class Impl;
@@ -0,0 +1,131 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ContentCatalog.hpp
+ * @brief index of the levels, series and games files
+ * @package managers
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_CONTENTCATALOG_H_
+#define MEMORIS_CONTENTCATALOG_H_
+
+#include <memory>
+#include <map>
+#include <string>
+#include <ctime>
+
+namespace memoris
+{
+namespace managers
+{
+
+/**
+ * @brief the indexed data directories
+ */
+enum class ContentDirectory
+{
+    OfficialLevels,
+    PersonalLevels,
+    OfficialSeries,
+    PersonalSeries,
+    Games
+};
+
+/**
+ * @brief the metadata of one indexed file; the stars and floors amounts are
+ * only set for the levels, the last unlocked serie only for the games
+ */
+struct ContentEntry
+{
+    std::size_t size {0};
+    std::time_t modificationTime {0};
+
+    unsigned short starsAmount {0};
+    unsigned short floorsAmount {0};
+
+    unsigned short lastUnlockedSerie {0};
+};
+
+/* the entries of one directory, indexed by file name without extension,
+   so they are listed by alphabetical order */
+using ContentEntries = std::map<std::string, ContentEntry>;
+
+class ContentCatalog
+{
+
+public:
+
+    /**
+     * @brief constructor, scans all the data directories once; a missing
+     * directory is considered empty
+     *
+     * @throw std::bad_alloc the implementation cannot be initialized;
+     * this exception is never caught and the program terminates
+     */
+    ContentCatalog();
+
+    ContentCatalog(const ContentCatalog&) = delete;
+
+    ContentCatalog& operator=(const ContentCatalog&) = delete;
+
+    /**
+     * @brief default destructor, stops watching the directories
+     */
+    ~ContentCatalog();
+
+    /**
+     * @brief returns the indexed files of the given directory; the changes
+     * of the directories since the previous call are applied first
+     *
+     * @param directory the directory to list
+     *
+     * @return const ContentEntries&
+     *
+     * not noexcept because the refreshed entries are allocated
+     */
+    const ContentEntries& getEntries(const ContentDirectory& directory)
+        const &;
+
+    /**
+     * @brief returns the metadata of the given file of the given directory,
+     * nullptr if the file does not exist
+     *
+     * @param directory the directory of the file
+     * @param name the file name without extension
+     *
+     * @return const ContentEntry*
+     *
+     * not noexcept because the refreshed entries are allocated
+     */
+    const ContentEntry* getEntry(
+        const ContentDirectory& directory,
+        const std::string& name
+    ) const &;
+
+private:
+
+    class Impl;
+    const std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
@@ -30,11 +30,6 @@
 
 #include <memory>
 
-namespace sf
-{
-class RenderWindow;
-}
-
 namespace memoris
 {
 
@@ -48,6 +43,7 @@ class CellsTexturesManager;
 class ShapesManager;
 class PlayingSerieManager;
 class EditingLevelManager;
+class ContentCatalog;
 }
 
 namespace entities
@@ -62,6 +58,10 @@ enum class ControllerId;
 
 namespace utils
 {
+
+class ProfiledWindow;
+class FrameProfiler;
+
 class Context
 {
 
@@ -79,16 +79,27 @@ public:
         SecondGameMusic /** < second game music (randomly selected) */
     };
 
+    /**
+     * @enum Context::WindowMode
+     * @brief how the game window is created
+     */
+    enum class WindowMode {
+        Fullscreen, /** < the game window, limited to the game frame rate */
+        Hidden /** < a hidden window without frames limit, for the tools */
+    };
+
     /**
      * @brief constructor
      *
+     * @param windowMode how the game window is created
+     *
      * @throw std::invalid_argument a texture resource or a font resource
      * cannot be loaded; the exception is never caught and the program stops
      *
      * @throw std::bad_alloc the implementation cannot be initialized;
      * the exception is never caught and the program stops
      */
-    Context();
+    Context(const WindowMode& windowMode = WindowMode::Fullscreen);
 
     Context(const Context&) = delete;
 
@@ -161,16 +172,30 @@ public:
      */
     managers::EditingLevelManager& getEditingLevelManager() const & noexcept;
 
+    /**
+     * @brief getter of the catalog of the levels, series and games files
+     *
+     * @return const managers::ContentCatalog&
+     */
+    const managers::ContentCatalog& getContentCatalog() const & noexcept;
+
     /**
      * @brief getter on the SFML window object
      *
-     * @return sf::RenderWindow&
+     * @return ProfiledWindow&
      *
      * do not return a constant reference, the SFML window object draw()
      * method is called almost everywhere in the game, and this method
      * is not constant
      */
-    sf::RenderWindow& getSfmlWindow() const & noexcept;
+    ProfiledWindow& getSfmlWindow() const & noexcept;
+
+    /**
+     * @brief getter of the frame profiler
+     *
+     * @return const FrameProfiler&
+     */
+    const FrameProfiler& getFrameProfiler() const & noexcept;
 
     /**
      * @brief return the elapsed time (milliseconds) since the clock started
@@ -194,20 +219,33 @@ public:
         noexcept;
 
     /**
-     * @brief load a new music file and play it,
-     * silently fails if the music cannot be loaded
+     * @brief opens the given music in background, called during the screen
+     * transition, so the music is ready when the next controller starts
+     *
+     * @param id music to open
+     *
+     * not noexcept because the requests of the music thread are protected
+     * by a mutex that may throw
+     */
+    void prefetchMusic(const MusicId& id) const &;
+
+    /**
+     * @brief crossfades from the playing music to the given music; the file
+     * is opened in background if it has not been prefetched, silently fails
+     * if the music cannot be loaded
      *
-     * @param id music to load
+     * @param id music to play
      *
-     * SFML sf::Music::openFromFile(), sf::Music::play() and
-     * setLoop() are not noexcept
+     * not noexcept because the requests of the music thread are protected
+     * by a mutex that may throw
      */
-    void loadMusicFile(const MusicId& id) const &;
+    void playMusic(const MusicId& id) const &;
 
     /**
      * @brief stop the playing music
      *
-     * SFML sf::Music::getStatus() and sf::Music::stop() are not noexcept
+     * not noexcept because the requests of the music thread are protected
+     * by a mutex that may throw
      */
     void stopMusic() const &;
 
@@ -234,6 +272,21 @@ public:
      */
     const std::string& getGameName() const & noexcept;
 
+    /**
+     * @brief setter of the path of the replay file to play when the game
+     * controller is created; an empty path means no replay
+     *
+     * @param path the path of the replay file
+     */
+    void setReplayFilePath(const std::string& path) const & noexcept;
+
+    /**
+     * @brief getter of the path of the replay file to play
+     *
+     * @return const std::string&
+     */
+    const std::string& getReplayFilePath() const & noexcept;
+
 private:
 
     class Impl;
@@ -70,6 +70,33 @@ public:
      */
     virtual const ControllerId& render() const & = 0;
 
+    /**
+     * @brief restores the controller as it was just after its creation;
+     * called when a pooled controller is displayed again; the overriding
+     * methods must call the parent method
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    virtual void reset() const &;
+
+    /**
+     * @brief returns the controller that is expected to be displayed
+     * after the current screen transition, if any; used to build the
+     * next controller during the transition
+     *
+     * @return const ControllerId&
+     */
+    const ControllerId& getExpectedControllerId() const & noexcept;
+
+    /**
+     * @brief returns true if the controller invalidates the window by
+     * itself when its scene changes, so the identical frames are not
+     * drawn again; the frames of the other controllers are always drawn
+     *
+     * @return const bool
+     */
+    virtual const bool isRedrawTracked() const & noexcept;
+
 protected:
 
     /**
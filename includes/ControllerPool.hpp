@@ -0,0 +1,107 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ControllerPool.hpp
+ * @brief keeps the menus controllers alive between two screens, so they
+ * are only built once and can be built during the previous transition
+ * @package controllers
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_CONTROLLERPOOL_H_
+#define MEMORIS_CONTROLLERPOOL_H_
+
+#include <memory>
+
+namespace memoris
+{
+
+namespace utils
+{
+class Context;
+}
+
+namespace controllers
+{
+
+class Controller;
+enum class ControllerId;
+
+class ControllerPool
+{
+
+public:
+
+    /**
+     * @brief constructor
+     *
+     * @param context the context to use
+     *
+     * @throw std::bad_alloc the implementation cannot be initialized;
+     * this exception is never caught and the program terminates
+     */
+    ControllerPool(const utils::Context& context);
+
+    ControllerPool(const ControllerPool&) = delete;
+
+    ControllerPool& operator=(const ControllerPool&) = delete;
+
+    /**
+     * @brief default destructor
+     */
+    ~ControllerPool();
+
+    /**
+     * @brief returns the controller of the given id; the pooled controllers
+     * are reset if they already exist, the others are created and replace
+     * the previous created controller; the textures expected by the
+     * controller are loaded before, the unused ones are released
+     *
+     * @param id the controller id
+     * @param previousControllerId previous controller id (for error controller)
+     *
+     * @return const Controller&
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    const Controller& getController(
+        const ControllerId& id,
+        const ControllerId& previousControllerId
+    ) &;
+
+    /**
+     * @brief creates the controller of the given id if it is pooled and
+     * does not exist yet; called during the screen transition that leads
+     * to this controller
+     *
+     * @param id the controller id
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void prepareController(const ControllerId& id) &;
+
+private:
+
+    class Impl;
+    const std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
@@ -35,6 +35,12 @@ class Color;
 
 namespace memoris
 {
+
+namespace game
+{
+enum class QuartersSwap : unsigned char;
+}
+
 namespace animations
 {
 
@@ -92,31 +98,11 @@ private:
     void applyPurpleColorOnCellsQuarters(const sf::Color& color) const &;
 
     /**
-     * @bried invert top left cells with bottom right cells
-     *
-     * not noexcept because it calls SFML methods that are not noexcept
-     */
-    void invertTopLeftWithBottomRight() const &;
-
-    /**
-     * @brief invert bottom left cells with top right cells
-     *
-     * not noexcept because it calls SFML methods that are not noexcept
-     */
-    void invertBottomLeftWithTopRight() const &;
-
-    /**
-     * @brief invert top right cells with bottom left cells
+     * @brief switches the given quarters of every floor
      *
-     * @param destination the delta to apply on the source cell
-     * in order to get the destination cell
-     *
-     * not noexcept because it calls SFML methods that are not noexcept
+     * @param swap the switched quarters
      */
-    void invertCells(
-        const unsigned short& source,
-        const short& difference
-    ) const &;
+    void swapQuarters(const game::QuartersSwap& swap) const &;
 
     class Impl;
     const std::unique_ptr<Impl> impl;
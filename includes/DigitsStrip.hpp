@@ -0,0 +1,137 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file DigitsStrip.hpp
+ * @brief the digits and the colon of one font size, rasterized once into
+ * one texture
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_DIGITSSTRIP_H_
+#define MEMORIS_DIGITSSTRIP_H_
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <memory>
+
+namespace sf
+{
+class Font;
+class Texture;
+}
+
+namespace memoris
+{
+namespace utils
+{
+
+/**
+ * @brief the position of one character into the strip and its bounds
+ * relatively to the baseline
+ */
+struct StripGlyph
+{
+    sf::IntRect textureRect;
+    sf::FloatRect bounds;
+};
+
+class DigitsStrip
+{
+
+public:
+
+    /**
+     * @brief constructor, renders the glyphs of the digits and the colon
+     * with the given font and copies them side by side into the strip
+     *
+     * @param font the font of the characters
+     * @param characterSize the size of the characters
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    DigitsStrip(
+        const sf::Font& font,
+        const unsigned int& characterSize
+    );
+
+    DigitsStrip(const DigitsStrip&) = delete;
+
+    DigitsStrip& operator=(const DigitsStrip&) = delete;
+
+    /**
+     * @brief default destructor
+     */
+    ~DigitsStrip();
+
+    /**
+     * @brief getter of the strip texture
+     *
+     * @return const sf::Texture&
+     */
+    const sf::Texture& getTexture() const & noexcept;
+
+    /**
+     * @brief returns the glyph of the given digit or of the colon
+     *
+     * @param character a digit or a colon
+     *
+     * @return const StripGlyph&
+     */
+    const StripGlyph& getGlyph(const char& character) const & noexcept;
+
+    /**
+     * @brief the horizontal space of every digit, the largest one of the
+     * font, so the width of a number only depends on its digits amount
+     *
+     * @return const float&
+     */
+    const float& getDigitAdvance() const & noexcept;
+
+    /**
+     * @brief the horizontal space of the colon
+     *
+     * @return const float&
+     */
+    const float& getColonAdvance() const & noexcept;
+
+    /**
+     * @brief the horizontal space of a blank character
+     *
+     * @return const float&
+     */
+    const float& getSpaceAdvance() const & noexcept;
+
+    /**
+     * @brief the size of the characters
+     *
+     * @return const unsigned int&
+     */
+    const unsigned int& getCharacterSize() const & noexcept;
+
+private:
+
+    class Impl;
+    const std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,156 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file DigitsText.hpp
+ * @brief numeric text drawn from a digits strip, for the values that change
+ * very often (clocks, counters)
+ * @package widgets
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_DIGITSTEXT_H_
+#define MEMORIS_DIGITSTEXT_H_
+
+#include <memory>
+
+namespace sf
+{
+class Color;
+}
+
+namespace memoris
+{
+
+namespace utils
+{
+class DigitsStrip;
+class ProfiledWindow;
+}
+
+namespace widgets
+{
+
+/**
+ * @brief one quad per character, textured from the digits strip; the quads
+ * are allocated once, updating the value only updates their positions and
+ * texture coordinates, without any string allocation or glyphs layout
+ */
+class DigitsText
+{
+
+public:
+
+    /**
+     * @brief constructor
+     *
+     * @param strip the digits strip to use, must exist as long as the text
+     * @param maximumCharacters the maximum amount of displayed characters
+     *
+     * @throw std::bad_alloc the implementation cannot be initialized;
+     * this exception is never caught and the program terminates
+     */
+    DigitsText(
+        const utils::DigitsStrip& strip,
+        const unsigned short& maximumCharacters
+    );
+
+    DigitsText(const DigitsText&) = delete;
+
+    DigitsText& operator=(const DigitsText&) = delete;
+
+    /**
+     * @brief default destructor
+     */
+    ~DigitsText();
+
+    /**
+     * @brief displays the text in one draw call
+     *
+     * @param window the window to use
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void display(utils::ProfiledWindow& window) const &;
+
+    /**
+     * @brief displays the given value
+     *
+     * @param value the value to display
+     */
+    void setNumber(const unsigned short& value) const & noexcept;
+
+    /**
+     * @brief displays the given time as 'mm : ss'
+     *
+     * @param minutes the minutes to display
+     * @param seconds the seconds to display
+     */
+    void setClock(
+        const unsigned short& minutes,
+        const unsigned short& seconds
+    ) const & noexcept;
+
+    /**
+     * @brief sets the top left corner of the text, as for a SFML text
+     *
+     * @param horizontalPosition the horizontal position
+     * @param verticalPosition the vertical position
+     */
+    void setPosition(
+        const float& horizontalPosition,
+        const float& verticalPosition
+    ) const & noexcept;
+
+    /**
+     * @brief sets the color of all the characters
+     *
+     * @param color the color to apply
+     */
+    void setColor(const sf::Color& color) const & noexcept;
+
+    /**
+     * @brief returns the width of the displayed characters
+     *
+     * @return const float
+     */
+    const float getWidth() const & noexcept;
+
+private:
+
+    /**
+     * @brief updates the quads of the given characters; the quads of the
+     * characters that did not change are kept, unless the text moved or a
+     * previous character changed its advance (a digit became a space...)
+     *
+     * @param characters the characters to display
+     * @param charactersAmount the amount of characters
+     */
+    void updateQuads(
+        const char* characters,
+        const unsigned short& charactersAmount
+    ) const & noexcept;
+
+    class Impl;
+    const std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
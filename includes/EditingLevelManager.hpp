@@ -38,6 +38,11 @@ namespace entities
 class Level;
 }
 
+namespace utils
+{
+class EditorJournal;
+}
+
 namespace managers
 {
 
@@ -116,6 +121,14 @@ public:
      */
     const std::vector<char>& getCellsBackup() const & noexcept;
 
+    /**
+     * @brief getter of the undo and redo history of the edited level; kept
+     * by the manager, so the history is still available after a level test
+     *
+     * @return const utils::EditorJournal&
+     */
+    const utils::EditorJournal& getJournal() const & noexcept;
+
 private:
 
     class Impl;
@@ -0,0 +1,136 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file EditorJournal.hpp
+ * @brief undo and redo history of the level editor, stored as cells changes
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_EDITORJOURNAL_H_
+#define MEMORIS_EDITORJOURNAL_H_
+
+#include <memory>
+
+namespace memoris
+{
+
+namespace entities
+{
+class Level;
+}
+
+namespace utils
+{
+
+class EditorJournal
+{
+
+public:
+
+    /**
+     * @brief constructor
+     *
+     * @throw std::bad_alloc the implementation cannot be initialized;
+     * this exception is never caught and the program terminates
+     */
+    EditorJournal();
+
+    EditorJournal(const EditorJournal&) = delete;
+
+    EditorJournal& operator=(const EditorJournal&) = delete;
+
+    /**
+     * @brief default destructor
+     */
+    ~EditorJournal();
+
+    /**
+     * @brief starts a brush stroke, all the changes recorded until the end
+     * of the stroke are undone and redone together; a stroke that is still
+     * opened is ended first
+     *
+     * not noexcept because it may allocate the stroke in the history
+     */
+    void beginStroke() const &;
+
+    /**
+     * @brief ends the current brush stroke, if any
+     *
+     * not noexcept because it may allocate the stroke in the history
+     */
+    void endStroke() const &;
+
+    /**
+     * @brief records the change of type of one cell; changes out of a brush
+     * stroke are a step of their own; a cell changed many times during one
+     * stroke is recorded once; the redo history is dropped
+     *
+     * @param index the index of the cell into the level
+     * @param previousType the type of the cell before the change
+     * @param nextType the type of the cell after the change
+     *
+     * not noexcept because it may allocate the change
+     */
+    void recordCellChange(
+        const unsigned short& index,
+        const char& previousType,
+        const char& nextType
+    ) const &;
+
+    /**
+     * @brief restores the previous types of the cells changed by the last
+     * step; returns false if there is nothing to undo
+     *
+     * @param level the edited level
+     *
+     * @return const bool
+     *
+     * not noexcept because the step is moved into the redo history
+     */
+    const bool undo(const entities::Level& level) const &;
+
+    /**
+     * @brief applies again the last undone step; returns false if there is
+     * nothing to redo
+     *
+     * @param level the edited level
+     *
+     * @return const bool
+     *
+     * not noexcept because the step is moved into the undo history
+     */
+    const bool redo(const entities::Level& level) const &;
+
+    /**
+     * @brief forgets the whole history, used when the edited level
+     * is replaced
+     */
+    void clear() const & noexcept;
+
+private:
+
+    class Impl;
+    const std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
@@ -30,6 +30,12 @@
 
 namespace memoris
 {
+
+namespace managers
+{
+enum class ContentDirectory;
+}
+
 namespace widgets
 {
 
@@ -42,7 +48,7 @@ public:
      * @brief constructor
      *
      * @param context the context to use
-     * @param directory path of the directory
+     * @param directory the listed directory of the content catalog
      * @param horizontalPosition the expected horizontal position of the widget
      *
      * @throw std::bad_alloc the implementation cannot be initialized;
@@ -50,7 +56,7 @@ public:
      */
     FilesSelectionListWidget(
         const utils::Context& context,
-        const char* directory,
+        const managers::ContentDirectory& directory,
         const float& horizontalPosition = 500.f
     );
 
@@ -64,22 +70,18 @@ public:
     ~FilesSelectionListWidget();
 
     /**
-     * @brief loads filenames from the directory specified by the constructor,
-     * the following names are ignored:
-     * - the parent directory name,
-     * - the current directory name,
-     * - empty names 
-     * the names are loaded into the sf::Text lists from the parent class
-     *
-     * NOTE: the code here segfault if the directory cannot be open;
-     * we voluntary do not handle any exception in order to let
-     * the program stops
+     * @brief loads the files names of the directory specified by the
+     * constructor from the content catalog, without extension and by
+     * alphabetical order; the directory is not read again, so a missing
+     * directory is simply an empty list
      *
      * this method is called directly from the constructor
      * but not directly defined within it;
      * the series editor requires to reload files from levels directory
+     *
+     * not noexcept because the items are allocated
      */
-    void loadFilesFromDirectory() const & noexcept;
+    void loadFilesFromCatalog() const &;
 
 private:
 
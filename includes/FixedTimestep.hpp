@@ -0,0 +1,94 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file FixedTimestep.hpp
+ * @brief splits the elapsed time into fixed duration steps; the steps
+ * that are late are all returned at once, so the logic never drifts when
+ * a frame is slow, and the time between two steps is available in order
+ * to interpolate the rendering
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_FIXEDTIMESTEP_H_
+#define MEMORIS_FIXEDTIMESTEP_H_
+
+#include <SFML/Config.hpp>
+
+namespace memoris
+{
+namespace utils
+{
+
+class FixedTimestep
+{
+
+public:
+
+    /**
+     * @brief constructor
+     *
+     * @param stepDuration the duration of one step, in milliseconds
+     * @param startTime the time of the beginning of the first step
+     */
+    FixedTimestep(
+        const sf::Int32& stepDuration,
+        const sf::Int32& startTime = 0
+    ) noexcept;
+
+    /**
+     * @brief restarts the steps from the given time, the steps that
+     * were not consumed are dropped
+     *
+     * @param time the time of the beginning of the next step
+     */
+    void restart(const sf::Int32& time) & noexcept;
+
+    /**
+     * @brief returns the amount of steps completed since the previous
+     * call and moves the beginning of the current step accordingly; the
+     * context clock is restarted at every controller change, a time
+     * before the current step restarts the steps
+     *
+     * @param time the current time
+     *
+     * @return const unsigned int
+     */
+    const unsigned int consumeSteps(const sf::Int32& time) & noexcept;
+
+    /**
+     * @brief returns the elapsed part of the current step, from 0 to 1;
+     * used to render a state between two steps
+     *
+     * @param time the current time
+     *
+     * @return const float
+     */
+    const float getInterpolation(const sf::Int32& time) const & noexcept;
+
+private:
+
+    sf::Int32 stepDuration;
+    sf::Int32 stepStartTime;
+};
+
+}
+}
+
+#endif
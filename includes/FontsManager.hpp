@@ -35,6 +35,13 @@ class Font;
 
 namespace memoris
 {
+
+namespace utils
+{
+class ResourcesLoader;
+class DigitsStrip;
+}
+
 namespace managers
 {
 
@@ -44,14 +51,17 @@ class FontsManager
 public:
 
     /**
-     * @brief constructor, loads each font file one by one, throw an exception
-     * if one loading process failed; the exception is not caught and stops
-     * the program, an error message is displayed in the console
+     * @brief constructor, loads each packed font one by one, throw an
+     * exception if one loading process failed; the exception is not caught
+     * and stops the program, an error message is displayed in the console
+     *
+     * @param loader the loader of the packed resources; the fonts are read
+     * directly from the pack, so the loader must exist as long as the fonts
      *
      * @throw std::invalid_argument throw an exception
      * if the file cannot be loaded
      */
-    FontsManager();
+    FontsManager(const utils::ResourcesLoader& loader);
 
     FontsManager(const FontsManager&) = delete;
 
@@ -76,13 +86,28 @@ public:
      */
     const sf::Font& getTextFont() const & noexcept;
 
+    /**
+     * @brief returns the digits strip of the text font with the given size;
+     * the strip is rendered at the first call for this size
+     *
+     * @param characterSize the size of the characters
+     *
+     * @return const utils::DigitsStrip&
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    const utils::DigitsStrip& getTextDigitsStrip(
+        const unsigned int& characterSize
+    ) const &;
+
 private:
 
     /**
-     * @brief load the font file from the given path into the font object
+     * @brief load the packed font with the given path into the font object
      * specified by reference
      *
      * @param font reference to the font object to set
+     * @param loader the loader of the packed resources
      * @param path constant string of the path to the file to load
      *
      * @throw std::invalid_argument throw an exception
@@ -93,11 +118,12 @@ private:
      * loading the file
      *
      * declared static because this method is only internally used to load
-     * a font object from a file; it is not supposed to be call according to
+     * a font object from the pack; it is not supposed to be call according to
      * the instance
      */
-    static void loadFontFromFile(
+    static void loadFontFromPack(
         sf::Font& font,
+        const utils::ResourcesLoader& loader,
         const std::string& path
     );
 
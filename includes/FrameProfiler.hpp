@@ -0,0 +1,158 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file FrameProfiler.hpp
+ * @brief measures the time spent into every part of the frames, keeps the
+ * last frames into a ring buffer and exports them as a Chrome trace
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_FRAMEPROFILER_H_
+#define MEMORIS_FRAMEPROFILER_H_
+
+#include <memory>
+#include <string>
+#include <cstdint>
+
+namespace memoris
+{
+namespace utils
+{
+
+class FrameProfiler
+{
+
+public:
+
+    /**
+     * @enum FrameProfiler::Section
+     * @brief the measured parts of a frame; the sections may be nested
+     * (the draws and the animations are measured during the render)
+     */
+    enum class Section : unsigned char
+    {
+        Loading, /** < creation of the controller (level loading...) */
+        Render, /** < controller render: events, update and draws */
+        Events, /** < events polling */
+        Animation, /** < level animations rendering */
+        Draw, /** < draws submission */
+        Display /** < window display (buffers swap and frame limit) */
+    };
+
+    static constexpr std::size_t SECTIONS_AMOUNT {6};
+
+    /**
+     * @brief the statistics of the last recorded frames
+     */
+    struct Statistics
+    {
+        /* frames durations, in microseconds */
+        std::uint32_t medianFrameTime {0};
+        std::uint32_t slowFrameTime {0};
+
+        /* draw calls of the last frame */
+        std::uint32_t drawCalls {0};
+
+        std::size_t framesAmount {0};
+    };
+
+    /**
+     * @brief constructor
+     *
+     * @throw std::bad_alloc the implementation cannot be initialized;
+     * this exception is never caught and the program terminates
+     */
+    FrameProfiler();
+
+    FrameProfiler(const FrameProfiler&) = delete;
+
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    /**
+     * @brief default destructor
+     */
+    ~FrameProfiler();
+
+    /**
+     * @brief returns the elapsed microseconds since the profiler creation,
+     * used as start time of the measured sections
+     *
+     * @return const std::uint64_t
+     */
+    const std::uint64_t getTime() const & noexcept;
+
+    /**
+     * @brief starts a new frame
+     */
+    void startFrame() const & noexcept;
+
+    /**
+     * @brief ends the current frame and pushes it into the ring buffer
+     */
+    void endFrame() const & noexcept;
+
+    /**
+     * @brief adds the time elapsed since the given start time to the given
+     * section of the current frame
+     *
+     * @param section the measured section
+     * @param startTime the time returned by getTime() when the section
+     * started
+     */
+    void addSectionTime(
+        const Section& section,
+        const std::uint64_t& startTime
+    ) const & noexcept;
+
+    /**
+     * @brief increments the draw calls of the current frame
+     */
+    void addDrawCall() const & noexcept;
+
+    /**
+     * @brief computes the median and the 99th percentile of the frames
+     * durations kept into the ring buffer
+     *
+     * @return Statistics
+     *
+     * not noexcept because it allocates a copy of the frames durations
+     */
+    Statistics getStatistics() const &;
+
+    /**
+     * @brief writes the frames kept into the ring buffer as a Chrome trace
+     * file (JSON events format, opened with chrome://tracing)
+     *
+     * @param filePath the trace file path
+     *
+     * @throw std::invalid_argument the trace file cannot be written
+     */
+    void writeChromeTrace(const std::string& filePath) const &;
+
+private:
+
+    class Impl;
+    const std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
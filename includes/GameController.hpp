@@ -43,6 +43,18 @@ namespace animations
 class LevelAnimation;
 }
 
+namespace game
+{
+enum class Action : unsigned char;
+enum class Event : unsigned char;
+struct StepResult;
+}
+
+namespace replays
+{
+struct Replay;
+}
+
 namespace controllers
 {
 
@@ -57,6 +69,8 @@ public:
      * @param context the context to use
      * @param level the level object to load
      * @param the default watching time to display when the game starts
+     * @param replay the replay to play instead of the player inputs,
+     * nullptr if the game is played by the player
      *
      * @throw std::invalid_argument the level file cannot be opened
      * this exception is caught by the controllers factory
@@ -68,7 +82,8 @@ public:
     GameController(
         const utils::Context& context,
         const std::shared_ptr<entities::Level>& level,
-        const unsigned short& displayedWatchingTime = 0
+        const unsigned short& displayedWatchingTime = 0,
+        const std::shared_ptr<const replays::Replay>& replay = nullptr
     );
 
     /**
@@ -83,6 +98,14 @@ public:
      */
     virtual const ControllerId& render() const & override;
 
+    /**
+     * @brief the level and the widgets invalidate the window when they
+     * change, the idle frames are not drawn
+     *
+     * @return const bool
+     */
+    virtual const bool isRedrawTracked() const & noexcept override;
+
 private:
 
     /**
@@ -116,22 +139,77 @@ private:
     void handlePickupEffects() const &;
 
     /**
-     * @brief moves the player (it is mandatory to check first if the player
-     * can actually move to its expected destination)
+     * @brief records the action into the replay of the game, applies it
+     * on the game state and renders it; saves the replay file when the
+     * game has just been won or lost
      *
-     * @param event the current event, contains the expected movement
+     * @param action the action to apply
      *
      * not noexcept because it calls SFML methods that are not noexcept
      */
-    void handlePlayerMovement(const sf::Event& event) const &;
+    void applyAction(const game::Action& action) const &;
 
     /**
-     * @brief applies the action of the new player cell; this method is called
+     * @brief applies one second of playing time on the game state and
+     * updates the timer
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void handleOneSecond() const &;
+
+    /**
+     * @brief applies the steps of the played replay reached by the
+     * current time
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void playReplaySteps() const &;
+
+    /**
+     * @brief writes the recorded replay into the last replay file;
+     * does nothing if the game is itself a replay
+     *
+     * not noexcept because it allocates and writes a file
+     */
+    void saveReplay() const &;
+
+    /**
+     * @brief indicates if the player can move now (the watching period,
+     * the animations and the ending period forbid the movements)
+     *
+     * @return const bool
+     */
+    const bool isPlayerMovementAllowed() const & noexcept;
+
+    /**
+     * @brief applies the player action on the game state and renders
+     * the collision or the movement
+     *
+     * @param action the movement expected by the player
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void handlePlayerAction(const game::Action& action) const &;
+
+    /**
+     * @brief moves the player on the level, according to a movement
+     * already applied on the game state
+     *
+     * @param result the result of the movement on the game state
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void handlePlayerMovement(const game::StepResult& result) const &;
+
+    /**
+     * @brief renders the effect of the new player cell; this method is called
      * immediately after the player moved
      *
+     * @param event the effect of the new player cell on the game state
+     *
      * not noexcept because it calls SFML methods that are not noexcept
      */
-    void executePlayerCellAction() const &;
+    void executePlayerCellAction(const game::Event& event) const &;
 
     /**
      * @brief this method ends the level, it displays the win or lose screen
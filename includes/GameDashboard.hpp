@@ -28,17 +28,13 @@
 
 #include <memory>
 
-namespace sf
-{
-class Text;
-}
-
 namespace memoris
 {
 
 namespace widgets
 {
 class TimerWidget;
+class DigitsText;
 }
 
 namespace utils
@@ -101,48 +97,37 @@ public:
     const unsigned short& getFoundStarsAmount() const & noexcept;
 
     /**
-     * @brief increments the found stars amount and update the SFML surface
-     *
-     * call SFML functions that are not noexcept
+     * @brief increments the found stars amount and updates the displayed digits
      */
-    void incrementFoundStars() const &;
+    void incrementFoundStars() const & noexcept;
 
     /**
-     * @brief increments the lifes amount and update the SFML surface
-     *
-     * call SFML functions that are not noexcept
+     * @brief increments the lifes amount and updates the displayed digits
      */
-    void incrementLifes() const &;
+    void incrementLifes() const & noexcept;
 
     /**
-     * @brief decrement the lifes amount and update the SFML surface
-     *
-     * call SFML functions that are not noexcept
+     * @brief decrement the lifes amount and updates the displayed digits
      */
-    void decrementLifes() const &;
+    void decrementLifes() const & noexcept;
 
     /**
      * @brief increase the watching time seconds by 3
-     *
-     * call SFML functions that are not noexcept
      */
-    void increaseWatchingTime() const &;
+    void increaseWatchingTime() const & noexcept;
 
     /**
      * @brief decrease the amount of seconds of the watching time by 3 seconds
-     *
-     * call SFML functions that are not noexcept
      */
-    void decreaseWatchingTime() const &;
+    void decreaseWatchingTime() const & noexcept;
 
     /**
-     * @brief updates the SFML surface that displays the current floor index
+     * @brief updates the digits that display the current floor index
      *
      * @param amount the amount to display in the dashboard
-     *
-     * call SFML functions that are not noexcept
      */
-    void updateCurrentFloor(const unsigned short& floorIndex) const &;
+    void updateCurrentFloor(const unsigned short& floorIndex) const &
+        noexcept;
 
 private:
 
@@ -152,32 +137,14 @@ private:
      * to get a correct horizontal position according to their width
      *
      * @param rightSideHorizontalPosition horizontal position of the surface
-     * @param sfmlSurface SFML texture
+     * @param digits the displayed digits
      *
      * @return const float
-     *
-     * call sf::Rect::getLocalBounds() method which is not noexcept
      */
     const float getHorizontalPositionMinusWidth(
         const float& rightSideHorizontalPosition,
-        const sf::Text& sfmlSurface
-    ) const &;
-
-    /**
-     * @brief replace SFML text surface content by numeric content;
-     * this is a common requirement from public methods that update
-     * the displayed values of the dashboard, so we simply refactor
-     * the std::to_string(number) into the function
-     *
-     * @param sfmlText SFML text surface to update
-     * @param numericValue the numeric value
-     *
-     * call SFML functions that are not noexcept
-     */
-    void updateSfmlTextByNumericValue(
-        sf::Text& sfmlText,
-        const unsigned short& numericValue
-    ) const &;
+        const widgets::DigitsText& digits
+    ) const & noexcept;
 
     class Impl;
     const std::unique_ptr<Impl> impl;
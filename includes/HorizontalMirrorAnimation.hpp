@@ -58,6 +58,13 @@ public:
 
 private:
 
+    /**
+     * @brief switch to the next step of the animation
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void playNextAnimationStep() const &;
+
     /**
      * @brief invert the top side cells with the bottom side cells
      *
@@ -87,23 +94,6 @@ private:
      * not noexcept because it calls SFML methods that are not noexcept
      */
     void displayLevelAndHorizontalSeparator() const &;
-
-    /**
-     * @brief calculates the interved index of the horizontal mirror for the
-     * given index
-     *
-     * @param floor the current floor
-     * @param line the current line of the cell (0...15)
-     * @param index the current index of the cell
-     * (0...255) (considere the current floor factor)
-     *
-     * @return const unsigned short
-     */
-    const unsigned short findInvertedIndex(
-        const unsigned short& floor,
-        const unsigned short& line,
-        const unsigned short& index
-    ) const & noexcept;
 };
 
 }
@@ -32,7 +32,8 @@
 namespace sf
 {
 class Transform;
-class Event;
+class Color;
+class Vertex;
 
 /* 'typedef unsigned char Uint8' in SFML/Config.hpp, we declare exactly
    the same type here in order to both use declaration forwarding and
@@ -43,14 +44,20 @@ typedef unsigned char Uint8;
 namespace memoris
 {
 
-namespace entities
+namespace utils
 {
-class Cell;
+class Context;
+class EditorJournal;
 }
 
-namespace utils
+namespace levels
 {
-class Context;
+struct LevelData;
+}
+
+namespace game
+{
+struct FloorPermutation;
 }
 
 namespace entities
@@ -72,21 +79,17 @@ public:
     Level(const utils::Context& context);
 
     /**
-     * @brief constructor that creates a level from a level file (game)
+     * @brief constructor that creates a level from a loaded level file (game)
      *
      * @param context the context to use
-     * @param filePath the level file to load (full path)
-     *
-     * @throw std::invalid_argument the level file cannot be opened;
-     * this exception is caught into the controllers factory
-     * and display an error message to the screen
+     * @param data the loaded level file content
      *
      * @throw std::bad_alloc the implementation cannot be initialized;
      * this exception is never caught and the program terminates
      */
     Level(
         const utils::Context& context,
-        const std::string& filePath
+        const levels::LevelData& data
     );
 
     Level(const Level&) = delete;
@@ -107,37 +110,13 @@ public:
 
     /**
      * @brief marks the player cell as visible and shows it
-     *
-     * not noexcept because it calls SFML methods that are not noexcept
      */
-    void showPlayerCell() const &;
+    void showPlayerCell() const & noexcept;
 
     /**
      * @brief hides all the cells of the level
-     *
-     * not noexcept because it calls SFML methods that are not noexcept
      */
-    void hideAllCells() const &;
-
-    /**
-     * @brief updates the player position to the top cell
-     */
-    void makeTopMovement() const & noexcept;
-
-    /**
-     * @brief updates the player position to the bottom cell
-     */
-    void makeBottomMovement() const & noexcept;
-
-    /**
-     * @brief updates the player position to the left cell
-     */
-    void makeLeftMovement() const & noexcept;
-
-    /**
-     * @brief updates the player position to the right cell
-     */
-    void makeRightMovement() const & noexcept;
+    void hideAllCells() const & noexcept;
 
     /**
      * @brief returns the position (both horizontal and vertical)
@@ -148,55 +127,49 @@ public:
     const std::pair<float, float> getPlayerPosition() const & noexcept;
 
     /**
-     * @brief checks if the player is allowed to go in the expected direction
-     * (does not leave the level or colide with a wall)
-     *
-     * @param event the current event, contains the expected direction
-     * @param floor the current displayed floor
+     * @brief render all the cells of the given floor; the whole floor
+     * is rendered with one unique draw call (cells atlas texture)
      *
-     * @return const bool
+     * @param floor the floor to render
      *
      * not noexcept because it calls SFML methods that are not noexcept
      */
-    const bool isPlayerMovementAllowed(
-        const sf::Event& event,
-        const unsigned short& floor
-    ) const &;
+    void display(const unsigned short& floor) const &;
 
     /**
-     * @brief render all the cells of the given floor
+     * @brief render all the cells of the given floor, rotated around the
+     * floor center by the given angle in addition to the current transform;
+     * used to render a rotation step in progress
      *
      * @param floor the floor to render
+     * @param degrees the additional rotation angle
      *
      * not noexcept because it calls SFML methods that are not noexcept
      */
-    void display(const unsigned short& floor) const &;
+    void display(
+        const unsigned short& floor,
+        const float& degrees
+    ) const &;
 
     /**
      * @brief update the transparency value of the current player cell
      *
      * @param alpha the player cell transparency to set
-     *
-     * not noexcept because it calls SFML methods that are not noexcept
      */
-    void setPlayerCellTransparency(const sf::Uint8& alpha) const &;
+    void setPlayerCellTransparency(const sf::Uint8& alpha) const & noexcept;
 
     /**
      * @brief get the current player cell type
      *
      * @return const char&
-     *
-     * not noexcept because it calls SFML methods that are not noexcept
      */
-    const char& getPlayerCellType() const &;
+    const char& getPlayerCellType() const & noexcept;
 
     /**
      * @brief updates the current player cell to an empty cell;
      * used when the player leaves a cell
-     *
-     * not noexcept because it calls SFML methods that are not noexcept
      */
-    void emptyPlayerCell() const &;
+    void emptyPlayerCell() const & noexcept;
 
     /**
      * @brief getter of the total stars amount in the level
@@ -245,26 +218,99 @@ public:
      *
      * @param transparency the value of SFML transparency
      * @param floor the concerned floor index
-     *
-     * not noexcept because it calls SFML methods that are not noexcept
      */
     void setCellsTransparency(
         const float& transparency,
         const unsigned short& floor
-    ) const &;
+    ) const & noexcept;
+
+    /**
+     * @brief getter of the type of the cell at the given index
+     *
+     * @param index the index of the cell into the level
+     *
+     * @return const char&
+     */
+    const char& getCellType(const unsigned short& index) const & noexcept;
 
     /**
-     * @brief getter of the cells container;
+     * @brief setter of the type of the cell at the given index; the
+     * texture coordinates of the cell quad are updated immediately
      *
-     * NOTE: we return a constant reference to the container; in that
-     * case, the elements of the container cannot be modified (that means
-     * each pointer into the container cannot be replaced by another one)
-     * but the objects pointed by those pointers can be modified;
-     * this function is used by animations that modify cells disposition
+     * @param index the index of the cell into the level
+     * @param type the type to set
+     */
+    void setCellType(
+        const unsigned short& index,
+        const char& type
+    ) const & noexcept;
+
+    /**
+     * @brief indicates if the cell at the given index is visible
+     *
+     * @param index the index of the cell into the level
      *
-     * @return const std::vector<std::unique_ptr<Cell>>&
+     * @return const bool
      */
-    const std::vector<std::unique_ptr<Cell>>& getCells() const & noexcept;
+    const bool isCellVisible(const unsigned short& index) const & noexcept;
+
+    /**
+     * @brief shows the cell at the given index
+     *
+     * @param index the index of the cell into the level
+     * @param transparency optional transparency of the cell
+     *
+     * NOTE: the transparency is used by some animations when updating
+     * the cells textures without immediately displaying it (horizontal
+     * mirror animation, vertical mirror animation)
+     */
+    void showCell(
+        const unsigned short& index,
+        const sf::Uint8& transparency = 255
+    ) const & noexcept;
+
+    /**
+     * @brief hides the cell at the given index, the hidden cell texture
+     * is rendered instead of the cell type texture
+     *
+     * @param index the index of the cell into the level
+     */
+    void hideCell(const unsigned short& index) const & noexcept;
+
+    /**
+     * @brief applies the given transparency on the cell at the given index
+     *
+     * @param index the index of the cell into the level
+     * @param alpha the SFML sf::Color object transparency value
+     */
+    void setCellColorTransparency(
+        const unsigned short& index,
+        const sf::Uint8& alpha
+    ) const & noexcept;
+
+    /**
+     * @brief moves every cell of the given floor (type, visibility and
+     * color) to its destination into the permutation; the player index
+     * is not updated
+     *
+     * @param floor the floor of the moved cells
+     * @param permutation the destination of every cell of the floor
+     */
+    void permuteFloorCells(
+        const unsigned short& floor,
+        const game::FloorPermutation& permutation
+    ) const & noexcept;
+
+    /**
+     * @brief applies the given color on the cell at the given index
+     *
+     * @param index the index of the cell into the level
+     * @param color the color to apply
+     */
+    void setCellColor(
+        const unsigned short& index,
+        const sf::Color& color
+    ) const & noexcept;
 
     /**
      * @brief dynamically creates a SFML Tranform object
@@ -301,6 +347,7 @@ public:
      *
      * @param floor the current level floor displayed
      * @param type the type to apply on the 'mouse hover' cell
+     * @param journal the editor journal where the changes are recorded
      *
      * @return bool
      *
@@ -308,26 +355,19 @@ public:
      */
     bool updateSelectedCellType(
         const unsigned short& floor,
-        const char& type
+        const char& type,
+        const utils::EditorJournal& journal
     ) const &;
 
     /**
      * @brief reset all cells to wall cells
-     *
-     * @throws std::terminate something wrong happened in the for_each
-     * algorithm (functions that are called there may throw exceptions as
-     * they are not declared noexcept)
-     *
-     * @throws std::bad_alloc for_each algorithm failed to allocate memory
      */
-    void allCellsAsWalls() const &;
+    void allCellsAsWalls() const & noexcept;
 
     /**
      * @brief show all the cells of the level
-     *
-     * not noexcept because it calls SFML functions that are not noexcept
      */
-    void showAllCells() const &;
+    void showAllCells() const & noexcept;
 
     /**
      * @brief checks if the level has exactly one departure and one arrival;
@@ -379,34 +419,69 @@ public:
 private:
 
     /**
-     * @brief increment the column index including the row index
-     * if the column index gets its maximum value
+     * @brief returns the horizontal and vertical position of the cell
+     * at the given index; positions are calculated from the index
+     * and are not stored per cell
+     *
+     * @param index the index of the cell into the level
      *
-     * @param row the row to increment
-     * @param column the column to increment
+     * @return const std::pair<float, float>
      */
-    void incrementRowAndColumnIndexes(
-        unsigned short& row,
-        unsigned short& column
+    const std::pair<float, float> getCellPosition(
+        const unsigned short& index
     ) const & noexcept;
 
     /**
-     * @brief returns a pointer to the created cell according to the given type
+     * @brief returns the level index of the cell of the given floor that is
+     * under the mouse cursor, or utils::NO_GRID_CELL if there is no one
      *
-     * @param horizontalPosition cell horizontal position
-     * @param verticalPosition cell vertical position
-     * @param type cell type
+     * @param floor the floor of the cell
      *
-     * @return std::unique_ptr<Cell>
+     * @return const short
      *
-     * @throw std::bad_alloc the pointer cannot be initialized;
-     * the exception is never caught and the program stops
+     * not noexcept because it calls SFML functions that are not noexcept
      */
-    std::unique_ptr<Cell> getCellByType(
-        const float& horizontalPosition,
-        const float& verticalPosition,
-        const char type
-    ) const &;
+    const short getMouseHoverCellIndex(const unsigned short& floor) const &;
+
+    /**
+     * @brief creates the vertices of every floor (one quad per cell)
+     * and sets their positions; called once by the constructors
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void initializeFloorsVertices() const &;
+
+    /**
+     * @brief refreshes the texture coordinates and the color of all the
+     * cells vertices; used after an operation on the whole level
+     */
+    void updateAllCellsVertices() const & noexcept;
+
+    /**
+     * @brief refreshes the atlas texture coordinates of the cell quad
+     * according to the cell type and visibility
+     *
+     * @param index the index of the cell into the level
+     */
+    void updateCellTextureCoordinates(const unsigned short& index) const &
+        noexcept;
+
+    /**
+     * @brief refreshes the color of the cell quad vertices
+     *
+     * @param index the index of the cell into the level
+     */
+    void updateCellColor(const unsigned short& index) const & noexcept;
+
+    /**
+     * @brief returns a pointer to the first of the four vertices
+     * of the cell quad
+     *
+     * @param index the index of the cell into the level
+     *
+     * @return sf::Vertex*
+     */
+    sf::Vertex* getCellVertices(const unsigned short& index) const & noexcept;
 
     class Impl;
     const std::unique_ptr<Impl> impl;
@@ -30,11 +30,10 @@
 
 namespace sf
 {
-/* 'typedef unsigned int Uint32' in SFML/Config.hpp, we declare exactly
+/* 'typedef signed int Int32' in SFML/Config.hpp, we declare exactly
    the same type here in order to both use declaration forwarding and
    prevent conflicting declaration */
-typedef unsigned int Uint32;
-typedef unsigned char Uint8;
+typedef signed int Int32;
 }
 
 namespace memoris
@@ -50,6 +49,11 @@ namespace entities
 class Level;
 }
 
+namespace game
+{
+struct FloorPermutation;
+}
+
 namespace animations
 {
 
@@ -58,17 +62,28 @@ class LevelAnimation
 
 public:
 
+    enum class FirstStep {
+        Immediate, /** < the first step is played at the first frame */
+        Delayed /** < the first step is played after one steps interval */
+    };
+
     /**
      * @brief constructor
      *
      * @param context the context to use
      * @param level the level of the animation
      * @param floor the animation floor index
+     * @param stepsInterval the fixed duration of one animation step
+     * @param firstStep when the first step of the animation is played
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
      */
     LevelAnimation(
         const utils::Context& context,
         const std::shared_ptr<entities::Level>& level,
-        const unsigned short& floor
+        const unsigned short& floor,
+        const sf::Int32& stepsInterval,
+        const FirstStep& firstStep
     );
 
     LevelAnimation(const LevelAnimation&) = delete;
@@ -115,51 +130,54 @@ protected:
     const unsigned short& getFloor() const & noexcept;
 
     /**
-     * @brief hides or shows the given cell at the given index
+     * @brief moves the cells of the given floor according to the given
+     * permutation; if the player is on this floor, the destination of the
+     * player cell becomes the updated player index (the player is moved
+     * at the end of the animation)
      *
-     * @param index the index of the cell to display or to hide
-     * @param visible boolean that indicates if the cell has to be hide or not
-     * @param transparency optional transparency of the cell
-     *
-     * NOTE: the transparency is used by some animations when updating
-     * the cells textures without immediately displaying it (horizontal
-     * mirror animation, vertical mirror animation)
-     *
-     * not noexcept because it calls SFML functions
+     * @param floor the floor of the moved cells
+     * @param permutation the destination of every cell of the floor
      */
-    void showOrHideCell(
-        const unsigned short& index,
-        const bool& visible,
-        const sf::Uint8& transparency = 255
-    ) const &;
+    void permuteFloorCells(
+        const unsigned short& floor,
+        const game::FloorPermutation& permutation
+    ) const & noexcept;
 
     /**
      * @brief increments the animation step
-     *
-     * not noexcept because it calls SFML functions that are not noexcept
      */
-    void incrementAnimationStep() const &;
+    void incrementAnimationStep() const & noexcept;
 
     /**
-     * @brief moves the player on a new cell according to the updated player
-     * cell index value
-
+     * @brief returns the amount of animation steps to play since the
+     * previous call; more than one when the frames are slower than the
+     * animation steps, so the animation duration does not depend on the
+     * frame rate
+     *
+     * @return const unsigned int
+     *
      * not noexcept because it calls SFML methods that are not noexcept
      */
-    void movePlayer() const &;
+    const unsigned int getElapsedAnimationSteps() const &;
 
     /**
-     * @brief getter of the last animation update time
+     * @brief returns the progression between the last played animation step
+     * and the next one, from 0 to 1; used to render the current step
+     * interpolated instead of jumping from one step to the next
+     *
+     * @return const float
      *
-     * @return const sf::Uint32&
+     * not noexcept because it calls SFML methods that are not noexcept
      */
-    const sf::Uint32& getAnimationLastUpdateTime() const & noexcept;
+    const float getStepInterpolation() const &;
 
     /**
-     * @brief setter of the last animation update time;
-     * used by the stairs animation
+     * @brief moves the player on a new cell according to the updated player
+     * cell index value
+
+     * not noexcept because it calls SFML methods that are not noexcept
      */
-    void setAnimationLastUpdateTime(const sf::Uint32& time) const & noexcept;
+    void movePlayer() const &;
 
     /**
      * @brief getter of the animation steps
@@ -36,7 +36,6 @@ namespace memoris
 namespace entities
 {
 class Level;
-class Cell;
 }
 
 namespace controllers
@@ -79,6 +78,14 @@ public:
      */
     virtual const ControllerId& render() const & override;
 
+    /**
+     * @brief the level and the widgets invalidate the window when they
+     * change, the idle frames are not drawn
+     *
+     * @return const bool
+     */
+    virtual const bool isRedrawTracked() const & noexcept override;
+
 private:
 
     /**
@@ -94,7 +101,7 @@ private:
      * new level file with the given name or overwrittes the existing one
      *
      * @param name the name of the level to create
-     * @param cells constant reference to the container of cells pointers
+     * @param cells constant reference to the list of cells types
      *
      * @throw std::ios_base::failure thrown if the file manipulation failed;
      * this exception is never caught by the program and the game directly
@@ -102,7 +109,7 @@ private:
      */
     void saveLevelFile(
         const std::string& name,
-        const std::vector<std::unique_ptr<entities::Cell>>& cells
+        const std::vector<char>& cells
     ) const &;
 
     /**
@@ -238,6 +245,16 @@ private:
      */
     const bool lastLevelVersionUpdated() const &;
 
+    /**
+     * @brief indicates if the displayed level name has to be marked as
+     * modified (named and not already marked)
+     *
+     * @return const bool
+     *
+     * not noexcept as it calls SFML methods that are not noexcept
+     */
+    const bool levelNameHasToBeMarked() const &;
+
     /**
      * @brief updates the level name with an asterisk
      * to indicate it has to be saved
@@ -64,6 +64,13 @@ public:
      */
     virtual const ControllerId& render() const & override;
 
+    /**
+     * @brief resets the menu and the title animation
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    virtual void reset() const & override;
+
 private:
 
     /**
@@ -28,6 +28,11 @@
 
 #include <memory>
 
+namespace sf
+{
+class Color;
+}
+
 namespace memoris
 {
 
@@ -70,12 +75,30 @@ public:
 private:
 
     /**
-     * @brief initialize the surfaces that create the gradient effect
+     * @brief initialize the vertices of the background and of the two
+     * gradients at both sides
+     *
+     * sf::VertexArray::append() is not noexcept
+     */
+    void initializeGradientVertices() const &;
+
+    /**
+     * @brief appends one quad of the full window height, the colors are
+     * interpolated from the left side to the right side
+     *
+     * @param left the left side horizontal position
+     * @param right the right side horizontal position
+     * @param leftColor the color of the left side vertices
+     * @param rightColor the color of the right side vertices
      *
-     * sf::RectangleShape setPosition(), setSize()
-     * and constructor are not noexcept
+     * sf::VertexArray::append() is not noexcept
      */
-    void initializeGradientRectangles() const &;
+    void appendQuad(
+        const float& left,
+        const float& right,
+        const sf::Color& leftColor,
+        const sf::Color& rightColor
+    ) const &;
 
     class Impl;
     const std::unique_ptr<Impl> impl;
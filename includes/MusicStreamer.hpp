@@ -0,0 +1,92 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * @file MusicStreamer.hpp
+ * @brief plays the musics from a dedicated thread: the musics files are
+ * opened by this thread and the musics are crossfaded, so the main thread
+ * never waits for a music file
+ * @package sounds
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_MUSICSTREAMER_H_
+#define MEMORIS_MUSICSTREAMER_H_
+
+#include <memory>
+#include <string>
+
+namespace memoris
+{
+namespace sounds
+{
+
+class MusicStreamer
+{
+
+public:
+
+    /**
+     * @brief constructor, starts the music thread
+     *
+     * @throw std::system_error the thread cannot be started; this
+     * exception is never caught and the program terminates
+     */
+    MusicStreamer();
+
+    MusicStreamer(const MusicStreamer&) = delete;
+
+    MusicStreamer& operator=(const MusicStreamer&) = delete;
+
+    /**
+     * @brief stops the musics and waits for the end of the music thread
+     */
+    ~MusicStreamer();
+
+    /**
+     * @brief asks the music thread to open the given music file, so the
+     * music can be played later without delay; returns immediately
+     *
+     * @param path the music file path
+     */
+    void prefetch(const std::string& path) const &;
+
+    /**
+     * @brief asks the music thread to crossfade from the playing music to
+     * the given music, in loop; the music file is opened by the thread if
+     * it has not been prefetched; returns immediately, silently fails if
+     * the music cannot be opened
+     *
+     * @param path the music file path
+     */
+    void play(const std::string& path) const &;
+
+    /**
+     * @brief asks the music thread to stop every music; returns immediately
+     */
+    void stop() const &;
+
+private:
+
+    class Impl;
+    const std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
@@ -1,4 +1,4 @@
-/**
+/*
  * Memoris
  * Copyright (C) 2017  Jean LELIEVRE
  *
@@ -17,54 +17,60 @@
 */
 
 /**
- * @file Sound.hpp
- * @brief stores a sound
- * @package sounds
+ * @file PerformanceOverlay.hpp
+ * @brief displays the frames durations and the draw calls on top of
+ * the screen (toggled with F3)
+ * @package widgets
  * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
  */
 
-#ifndef MEMORIS_SOUND_H_
-#define MEMORIS_SOUND_H_
+#ifndef MEMORIS_PERFORMANCEOVERLAY_H_
+#define MEMORIS_PERFORMANCEOVERLAY_H_
 
 #include <memory>
 
 namespace memoris
 {
-namespace sounds
+
+namespace utils
+{
+class Context;
+}
+
+namespace widgets
 {
 
-class Sound
+class PerformanceOverlay
 {
 
 public:
 
     /**
-     * @brief loads sound with the given file name
+     * @brief constructor
      *
-     * @param fileName sound file name (no path and no extension)
+     * @param context the current context
      *
-     * @throw std::bad_alloc the implementation cannot be initialized,
-     * this exception is never caught and the program terminates
+     * not noexcept because it calls SFML methods that are not noexcept
      */
-    Sound(const std::string& fileName);
+    PerformanceOverlay(const utils::Context& context);
 
-    Sound(const Sound&) = delete;
+    PerformanceOverlay(const PerformanceOverlay&) = delete;
 
-    Sound& operator=(const Sound&) = delete;
+    PerformanceOverlay& operator=(const PerformanceOverlay&) = delete;
 
     /**
      * @brief default destructor
      */
-    ~Sound();
+    ~PerformanceOverlay();
 
     /**
-     * @brief plays the sound if correctly loaded
-     *
-     * NOTE: this method silently does nothing if the sound is not loaded
+     * @brief displays the median frame time, the 99th percentile frame
+     * time and the draw calls of the last frame; the statistics are
+     * refreshed twice per second
      *
-     * no noexcept because sf::Sound::play is not noexcept
+     * not noexcept because it calls SFML methods that are not noexcept
      */
-    void play() const &;
+    void display() const &;
 
 private:
 
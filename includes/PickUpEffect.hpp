@@ -48,14 +48,15 @@ public:
     /**
      * @brief constructor
      *
-     * @param texture the texture to animate
+     * @param texture the texture to animate, kept as long as the effect
+     * exists
      * @param positions horizontal and vertical positions
      *
      * @throw std::bad_alloc cannot initialize the implementation;
      * this exception is never caught and the program stops
      */
     PickUpEffect(
-        const sf::Texture& texture,
+        const std::shared_ptr<const sf::Texture>& texture,
         const std::pair<float, float>& positions
     );
 
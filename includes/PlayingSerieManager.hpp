@@ -42,6 +42,11 @@ namespace entities
 class SerieResult;
 }
 
+namespace levels
+{
+struct LevelData;
+}
+
 namespace managers
 {
 
@@ -95,15 +100,18 @@ public:
     const size_t getRemainingLevelsAmount() const & noexcept;
 
     /**
-     * @brief returns the next item of the levels container according to the
-     * FIFO specifications and remove the returned item from the queue
+     * @brief returns the next level of the serie according to the FIFO
+     * specifications and removes it from the queue; the level is usually
+     * already loaded by the prefetch worker, the loading of the following
+     * level is started in background before returning
      *
-     * @return const std::string
+     * @return levels::LevelData
      *
-     * not noexcept because the pop() and front() methods of std::queue
-     * may throw if the container is empty
+     * @throw std::invalid_argument the level file cannot be loaded;
+     * this exception is caught into the controllers factory
+     * and display an error message to the screen
      */
-    const std::string getNextLevelName() const &;
+    levels::LevelData getNextLevel() const &;
 
     /**
      * @brief setter for the watching time
@@ -231,6 +239,15 @@ private:
     const sf::String fillMissingTimeDigits(const unsigned short& numericValue)
         const &;
 
+    /**
+     * @brief starts to load the front level of the queue into a worker
+     * thread; does nothing if the queue is empty; the level is loaded
+     * synchronously by getNextLevel() if no thread can be created
+     *
+     * not noexcept because the allocations may throw
+     */
+    void prefetchNextLevel() const &;
+
     class Impl;
     const std::unique_ptr<Impl> impl;
 };
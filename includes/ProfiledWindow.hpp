@@ -0,0 +1,161 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ProfiledWindow.hpp
+ * @brief SFML render window that reports its draw calls and its events
+ * polling time to the frame profiler
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_PROFILEDWINDOW_H_
+#define MEMORIS_PROFILEDWINDOW_H_
+
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+
+namespace memoris
+{
+namespace utils
+{
+
+class FrameProfiler;
+
+/* sf::RenderTarget::draw() and sf::Window::pollEvent() are not virtual:
+   the methods below hide them, so they are only called when the window
+   is used through this class (this is the type returned by the context);
+   the window also tracks the scene changes: a frame is only drawn and
+   displayed if the window has been invalidated since the previous one */
+class ProfiledWindow : public sf::RenderWindow
+{
+
+public:
+
+    /**
+     * @brief constructor, creates the SFML window
+     *
+     * @param profiler the profiler the window reports to
+     * @param mode the SFML video mode of the window
+     * @param title the window title
+     * @param style the SFML window style
+     *
+     * not noexcept because the SFML window constructor is not noexcept
+     */
+    ProfiledWindow(
+        const FrameProfiler& profiler,
+        const sf::VideoMode& mode,
+        const sf::String& title,
+        const sf::Uint32& style
+    );
+
+    /**
+     * @brief counts and measures the draw call, then draws; does nothing
+     * if the current frame is not drawn
+     *
+     * @param drawable the drawable object
+     * @param states the render states
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void draw(
+        const sf::Drawable& drawable,
+        const sf::RenderStates& states = sf::RenderStates::Default
+    );
+
+    /**
+     * @brief counts and measures the draw call, then draws; does nothing
+     * if the current frame is not drawn
+     *
+     * @param vertices the vertices to draw
+     * @param verticesAmount the amount of vertices
+     * @param type the primitive type of the vertices
+     * @param states the render states
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void draw(
+        const sf::Vertex* vertices,
+        std::size_t verticesAmount,
+        sf::PrimitiveType type,
+        const sf::RenderStates& states = sf::RenderStates::Default
+    );
+
+    /**
+     * @brief measures the events polling, then polls the next event
+     *
+     * @param event the event to fill
+     *
+     * @return bool
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    bool pollEvent(sf::Event& event);
+
+    /**
+     * @brief sets the frames limit of the window; the limit is also
+     * applied to the frames that are not drawn
+     *
+     * @param limit the maximum frames per second, 0 for no limit
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void setFramerateLimit(unsigned int limit);
+
+    /**
+     * @brief marks the displayed scene as changed, the next frame is
+     * drawn; called by every component that changes what it displays,
+     * and for every polled event
+     */
+    void invalidate() & noexcept;
+
+    /**
+     * @brief starts a new frame, the frame is drawn only if the window
+     * has been invalidated during the previous frame; the draw calls of
+     * a frame that is not drawn are ignored
+     *
+     * @return const bool true if the frame is drawn
+     */
+    const bool startFrame() & noexcept;
+
+    /**
+     * @brief displays the frame if it is drawn, otherwise waits for the
+     * frame duration; the previous frame stays on the screen
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void endFrame() &;
+
+private:
+
+    const FrameProfiler& profiler;
+
+    sf::Clock frameClock;
+
+    sf::Time frameDuration {sf::Time::Zero};
+
+    /* the first frame is always drawn */
+    bool invalidated {true};
+    bool frameDrawn {true};
+};
+
+}
+}
+
+#endif
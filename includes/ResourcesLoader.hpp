@@ -0,0 +1,109 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ResourcesLoader.hpp
+ * @brief maps the resources pack and decodes its pictures on demand,
+ * on every processor core; the managers only upload the decoded pictures
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_RESOURCESLOADER_H_
+#define MEMORIS_RESOURCESLOADER_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sf
+{
+class Image;
+}
+
+namespace memoris
+{
+
+namespace resources
+{
+struct ResourceData;
+}
+
+namespace utils
+{
+
+class ResourcesLoader
+{
+
+public:
+
+    /**
+     * @brief constructor, maps the resources pack
+     *
+     * @throw std::invalid_argument the pack cannot be opened; the exception
+     * is never caught to voluntary stop the program
+     */
+    ResourcesLoader();
+
+    ResourcesLoader(const ResourcesLoader&) = delete;
+
+    ResourcesLoader& operator=(const ResourcesLoader&) = delete;
+
+    /**
+     * @brief default destructor
+     */
+    ~ResourcesLoader();
+
+    /**
+     * @brief decodes the given pictures, one worker per processor core;
+     * the decoding does not use the graphic card, so only the textures
+     * creation has to stay into the main thread
+     *
+     * @param names the pictures paths into the resources directory
+     *
+     * @return std::vector<sf::Image>
+     *
+     * @throw std::invalid_argument one picture is not into the pack or
+     * cannot be decoded
+     */
+    std::vector<sf::Image> decodePictures(
+        const std::vector<std::string>& names
+    ) const &;
+
+    /**
+     * @brief returns the bytes of the resource with the given name; the
+     * bytes are valid as long as the loader exists (fonts...)
+     *
+     * @param name the resource path into the resources directory
+     *
+     * @return const resources::ResourceData&
+     *
+     * @throw std::invalid_argument the resource is not into the pack
+     */
+    const resources::ResourceData& getResource(const std::string& name)
+        const &;
+
+private:
+
+    class Impl;
+    const std::unique_ptr<Impl> impl;
+};
+
+}
+}
+
+#endif
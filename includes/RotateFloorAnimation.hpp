@@ -28,16 +28,8 @@
 
 #include "LevelAnimation.hpp"
 
-#include <vector>
-
 namespace memoris
 {
-
-namespace entities
-{
-class Cell;
-}
-
 namespace animations
 {
 
@@ -94,122 +86,10 @@ private:
     void playNextAnimationStep() const &;
 
     /**
-     * @brief rotate the cells of the floor on the left
-     *
-     * not noexcept because it calls SFML methods that are not noexcept
+     * @brief rotates the cells of every floor and moves the player
      */
     void rotateCells() const &;
 
-    /**
-     * @brief rotates one specific given cell at the given index
-     *
-     * @param index the index of the cell to rotate
-     * @param floor the current index floor
-     *
-     * not noexcept because it calls SFML methods that are not noexcept
-     */
-    void rotateCell(
-        const unsigned short& index,
-        const unsigned short& floor
-    ) const &;
-
-    /**
-     * @brief rotates one specific given cell from a specific quarter array
-     *
-     * @param index the index of the cell to rotate (quarter array index)
-     * @param convertedIndex the index of the cell to rotate (level index)
-     * @param floor the current index floor
-     * @param cellsCopy array used to store temporarily the quarter of cells
-     *
-     * TODO: check if an array of cells is enough
-     *
-     * not noexcept because it calls SFML methods that are not noexcept
-     */
-    void rotateCellFromQuarter(
-        const unsigned short& index,
-        const unsigned short& convertedIndex,
-        const unsigned short& floor,
-        const std::vector<std::unique_ptr<entities::Cell>>& cellsCopy
-    ) const &;
-
-    /**
-     * @brief converts the given index into orthogonal coordinates
-     *
-     * @param index the index to convert
-     * @param floor the current index floor
-     *
-     * @return std::pair<short, short>
-     */
-    std::pair<short, short>
-    getCoordinatesFromIndex(
-        const unsigned short& index,
-        const unsigned short& floor
-    ) const & noexcept;
-
-    /**
-     * @brief converts the given coordinates into index
-     *
-     * @param x the horizontal coordinate
-     * @param y the vertical coordinate
-     *
-     * @return unsigned short
-     * 
-     * parameters are passed by copy, we directly modifies the coordinates
-     * for index calculation without creating new variables within the function
-     */
-    unsigned short getIndexFromCoordinates(
-        short x,
-        short y
-    ) const & noexcept;
-
-    /**
-     * @brief updates the destination cell visibility
-     * according to the source cell visibility
-     *
-     * @param source the source cell
-     * @param destination the destination cell
-     *
-     * not noexcept as some functions call the SFML methods
-     */
-    void updateDestinationCellVisibility(
-        const entities::Cell& source,
-        const entities::Cell& destination
-    ) const &;
-
-    /**
-     * @brief generates a copy of a given cell in order to be stored
-     * into a container that stores a quarter of cell (for rotation);
-     * it only copies the type and the visibility, the only two elements
-     * that are necessary to be known in order to copy the cell
-     * for rotation purposes; positions are set to 0 as they are useless;
-     *
-     * @param cell the source cell to copy
-     *
-     * @return std::unique_ptr<entities::Cell>
-     *
-     * not noexcept as the function calls some SFML functions
-     *
-     * the returned unique_ptr is not constant as it has to be moved by client
-     */
-    std::unique_ptr<entities::Cell> getCellCopy(
-        const entities::Cell& source
-    ) const &;
-
-    /**
-     * @brief updates the horizontal or vertical coordinates
-     * according to the rotation direction
-     *
-     * @param x the orthogonal x coordinate
-     * @param y the orthogonal y coordinate
-     *
-     * the passed references are supposed to modify
-     * their values within the function
-     */
-    void updateCoordinates(
-        short& x,
-        short& y
-    ) const & noexcept;
-
     class Impl;
     const std::unique_ptr<Impl> impl;
 };
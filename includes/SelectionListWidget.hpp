@@ -28,11 +28,11 @@
 
 #include <memory>
 #include <vector>
+#include <string>
 
 namespace sf
 {
 class Sprite;
-class Text;
 
 template<typename T>
 class Vector2;
@@ -49,6 +49,12 @@ class Context;
 namespace widgets
 {
 
+/**
+ * @brief list of selectable strings; the strings are stored apart from the
+ * displayed texts: only the visible rows have a SFML text, updated when the
+ * list is scrolled or modified, so the cost of displaying and
+ * scrolling the list does not depend on the amount of items
+ */
 class SelectionListWidget
 {
 
@@ -99,7 +105,7 @@ public:
      *
      * @return std::string
      *
-     * sf::Text::getString() is not noexcept
+     * not noexcept because the returned string is allocated
      *
      * returned string is not constant, because the returned object
      * can be use in the serie editor in order to move rvalues
@@ -107,7 +113,7 @@ public:
     std::string getCurrentItem() const &;
 
     /**
-     * @brief getter of the current list items amount
+     * @brief getter of the items amount
      *
      * @return const unsigned short
      */
@@ -135,36 +141,37 @@ public:
     const bool canScrollDown() const & noexcept;
 
     /**
-     * @brief scroll the list in the given direction (movement)
+     * @brief scroll the list in the given direction (movement); only moves
+     * the visible window, the visible rows are updated at the next display
      *
      * @param movement the movement to perform, up or down
-     *
-     * not noexcept because SFML sf::Text::setPosition() is not noexcept
      */
-    void updateAllItemsPosition(const ListMovement& movement) const &;
+    void updateAllItemsPosition(const ListMovement& movement) const &
+        noexcept;
 
     /**
      * @brief deletes the selected item
      *
-     * not noexcept because SFML sf::Text::setPosition() is not noexcept
+     * not noexcept because it calls std::vector<T>::erase()
+     * that is not noexcept
      */
     void deleteSelectedItem() const &;
 
     /**
-     * @brief add one string into the displayed list
+     * @brief add one string at the end of the list
      *
-     * @param text the text to display for the new item
+     * @param text the new item
      *
-     * not noexcept because SFML sf::Text methods are not noexcept
+     * not noexcept because the item is allocated
      */
     void addItem(std::string&& text) const &;
 
     /**
-     * @brief getter of the stored values in the list
+     * @brief getter of all the items of the list
      *
-     * @return const std::vector<sf::Text>&
+     * @return const std::vector<std::string>&
      */
-    const std::vector<sf::Text>& getTexts() const & noexcept;
+    const std::vector<std::string>& getItems() const & noexcept;
 
     /**
      * @brief deletes all the items from the list
@@ -191,6 +198,21 @@ private:
      */
     void displaySelector() const &;
 
+    /**
+     * @brief returns the amount of rows currently displayed
+     *
+     * @return const unsigned short
+     */
+    const unsigned short getVisibleRowsAmount() const & noexcept;
+
+    /**
+     * @brief sets the strings of the visible rows according to the first
+     * visible item; called by display() when the list has been changed
+     *
+     * not noexcept because it calls SFML functions that are not noexcept
+     */
+    void updateVisibleRows() const &;
+
     /**
      * @brief indicates if the mouse is currently on an item of the list
      *
@@ -30,6 +30,17 @@
 
 namespace memoris
 {
+
+namespace utils
+{
+class ResourcesLoader;
+}
+
+namespace controllers
+{
+enum class ControllerId;
+}
+
 namespace managers
 {
 
@@ -39,12 +50,15 @@ class SoundsManager
 public:
 
     /**
-     * @brief constructor
+     * @brief constructor, the sounds are decoded by controller
+     * (see preloadControllerSounds())
+     *
+     * @param loader the loader of the packed resources
      *
      * @throw std::bad_alloc the implementation cannot be initialized;
      * this exception is never caught and the program terminates
      */
-    SoundsManager();
+    SoundsManager(const utils::ResourcesLoader& loader);
 
     SoundsManager(const SoundsManager&) = delete;
 
@@ -55,6 +69,18 @@ public:
      */
     ~SoundsManager();
 
+    /**
+     * @brief releases the decoded sounds that are not expected by the
+     * given controller, then decodes the sounds it may play; called before
+     * the creation of every controller
+     *
+     * @param id the id of the next controller
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void preloadControllerSounds(const controllers::ControllerId& id)
+        const &;
+
     /**
      * @brief plays the move selector sound
      *
@@ -1,4 +1,4 @@
-/**
+/*
  * Memoris
  * Copyright (C) 2017  Jean LELIEVRE
  *
@@ -15,10 +15,10 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
-
 /**
  * @file TexturesManager.hpp
- * @brief loads and provides the textures assets
+ * @brief loads the textures assets on demand and releases the textures
+ * that are not used anymore
  * @package managers
  * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
  */
@@ -35,155 +35,243 @@ class Texture;
 
 namespace memoris
 {
+
+namespace utils
+{
+class ResourcesLoader;
+}
+
+namespace controllers
+{
+enum class ControllerId;
+}
+
 namespace managers
 {
 
+/* the texture stays loaded as long as one handle exists */
+using TextureHandle = std::shared_ptr<const sf::Texture>;
+
 class TexturesManager
 {
 
 public:
 
+    enum class TextureId
+    {
+        Star,
+        Life,
+        Target,
+        Time,
+        Floor,
+        New,
+        Open,
+        Save,
+        Cursor,
+        Exit,
+        Test,
+        ArrowUp,
+        ArrowDown,
+        ScrollArrowDown,
+        ScrollArrowUp
+    };
+
     /**
-     * @brief constructor, loads each texture one by one, stop if one texture
-     * cannot be loaded and throw an exception
+     * @brief constructor, no texture is loaded before it is requested
+     * or preloaded for a controller
+     *
+     * @param loader the loader of the packed pictures
      *
-     * @throw std::invalid_argument thrown if the texture cannot be loaded,
-     * the exception is never caught to voluntary stop the program
+     * @throw std::bad_alloc the implementation cannot be initialized;
+     * this exception is never caught and the program terminates
      */
-    TexturesManager();
+    TexturesManager(const utils::ResourcesLoader& loader);
 
     TexturesManager(const TexturesManager&) = delete;
 
     TexturesManager& operator=(const TexturesManager&) = delete;
 
     /**
-     * @brief default constructor
+     * @brief default destructor
      */
     ~TexturesManager();
 
     /**
-     * @brief getter for the star texture
+     * @brief releases the loaded textures that are not used anymore and
+     * not expected by the given controller, then loads together the
+     * textures expected by the given controller; called before the
+     * creation of every controller
+     *
+     * @param id the id of the next controller
+     *
+     * @throw std::invalid_argument one texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
+     */
+    void preloadControllerTextures(const controllers::ControllerId& id)
+        const &;
+
+    /**
+     * @brief getter for the star texture, loaded if necessary
+     *
+     * @return TextureHandle
      *
-     * @return const sf::Texture&
+     * @throw std::invalid_argument the texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
      */
-    const sf::Texture& getStarTexture() const & noexcept;
+    TextureHandle getStarTexture() const &;
 
     /**
-     * @brief getter for the life texture
+     * @brief getter for the life texture, loaded if necessary
      *
-     * @return const sf::Texture&
+     * @return TextureHandle
+     *
+     * @throw std::invalid_argument the texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
      */
-    const sf::Texture& getLifeTexture() const & noexcept;
+    TextureHandle getLifeTexture() const &;
 
     /**
-     * @brief getter for the target texture
+     * @brief getter for the target texture, loaded if necessary
+     *
+     * @return TextureHandle
      *
-     * @return const sf::Texture&
+     * @throw std::invalid_argument the texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
      */
-    const sf::Texture& getTargetTexture() const & noexcept;
+    TextureHandle getTargetTexture() const &;
 
     /**
-     * @brief getter for the time texture
+     * @brief getter for the time texture, loaded if necessary
      *
-     * @return const sf::Texture&
+     * @return TextureHandle
+     *
+     * @throw std::invalid_argument the texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
      */
-    const sf::Texture& getTimeTexture() const & noexcept;
+    TextureHandle getTimeTexture() const &;
 
     /**
-     * @brief getter for the floor texture
+     * @brief getter for the floor texture, loaded if necessary
+     *
+     * @return TextureHandle
      *
-     * @return const sf::Texture&
+     * @throw std::invalid_argument the texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
      */
-    const sf::Texture& getFloorTexture() const & noexcept;
+    TextureHandle getFloorTexture() const &;
 
     /**
-     * @brief getter for the new texture
+     * @brief getter for the new texture, loaded if necessary
      *
-     * @return const sf::Texture&
+     * @return TextureHandle
+     *
+     * @throw std::invalid_argument the texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
      */
-    const sf::Texture& getNewTexture() const & noexcept;
+    TextureHandle getNewTexture() const &;
 
     /**
-     * @brief getter for the open texture
+     * @brief getter for the open texture, loaded if necessary
+     *
+     * @return TextureHandle
      *
-     * @return const sf::Texture&
+     * @throw std::invalid_argument the texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
      */
-    const sf::Texture& getOpenTexture() const & noexcept;
+    TextureHandle getOpenTexture() const &;
 
     /**
-     * @brief getter for the save texture
+     * @brief getter for the save texture, loaded if necessary
      *
-     * @return const sf::Texture&
+     * @return TextureHandle
+     *
+     * @throw std::invalid_argument the texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
      */
-    const sf::Texture& getSaveTexture() const & noexcept;
+    TextureHandle getSaveTexture() const &;
 
     /**
-     * @brief getter for the cursor texture
+     * @brief getter for the cursor texture, loaded if necessary
+     *
+     * @return TextureHandle
      *
-     * @return const sf::Texture&
+     * @throw std::invalid_argument the texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
      */
-    const sf::Texture& getCursorTexture() const & noexcept;
+    TextureHandle getCursorTexture() const &;
 
     /**
-     * @brief getter for the exit texture
+     * @brief getter for the exit texture, loaded if necessary
      *
-     * @return const sf::Texture&
+     * @return TextureHandle
+     *
+     * @throw std::invalid_argument the texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
      */
-    const sf::Texture& getExitTexture() const & noexcept;
+    TextureHandle getExitTexture() const &;
 
     /**
-     * @brief getter for the test texture
+     * @brief getter for the test texture, loaded if necessary
+     *
+     * @return TextureHandle
      *
-     * @return const sf::Texture&
+     * @throw std::invalid_argument the texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
      */
-    const sf::Texture& getTestTexture() const & noexcept;
+    TextureHandle getTestTexture() const &;
 
     /**
-     * @brief getter for the arrow up texture
+     * @brief getter for the arrow up texture, loaded if necessary
      *
-     * @return const sf::Texture&
+     * @return TextureHandle
+     *
+     * @throw std::invalid_argument the texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
      */
-    const sf::Texture& getArrowUpTexture() const & noexcept;
+    TextureHandle getArrowUpTexture() const &;
 
     /**
-     * @brief getter for the arrow down texture
+     * @brief getter for the arrow down texture, loaded if necessary
+     *
+     * @return TextureHandle
      *
-     * @return const sf::Texture&
+     * @throw std::invalid_argument the texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
      */
-    const sf::Texture& getArrowDownTexture() const & noexcept;
+    TextureHandle getArrowDownTexture() const &;
 
     /**
-     * @brief getter for the scroll arrow down texture
+     * @brief getter for the scroll arrow down texture, loaded if necessary
      *
-     * @return const sf::Texture&
+     * @return TextureHandle
+     *
+     * @throw std::invalid_argument the texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
      */
-    const sf::Texture& getScrollArrowDownTexture() const & noexcept;
+    TextureHandle getScrollArrowDownTexture() const &;
 
     /**
-     * @brief getter for the scroll arrow up texture
+     * @brief getter for the scroll arrow up texture, loaded if necessary
+     *
+     * @return TextureHandle
      *
-     * @return const sf::Texture&
+     * @throw std::invalid_argument the texture cannot be loaded; the
+     * exception is never caught to voluntary stop the program
      */
-    const sf::Texture& getScrollArrowUpTexture() const & noexcept;
+    TextureHandle getScrollArrowUpTexture() const &;
 
 private:
 
     /**
-     * @brief load a texture from the textures folder
+     * @brief returns the texture with the given id, loads it if necessary
      *
-     * @param texture reference to the SFML texture object that has to be set
-     * @param path file path of the *.png picture to load
+     * @param id the texture id
      *
-     * @throw std::invalid_argument the given file cannot be opened; the
-     * exception is not caught in order to close the program directly if at
-     * least one texture cannot be loaded
+     * @return TextureHandle
      *
-     * not const because modifies the textures of the object
+     * @throw std::invalid_argument the texture cannot be loaded
      */
-    void loadTexture(
-        sf::Texture& texture,
-        const std::string& path
-    ) &;
+    TextureHandle getTexture(const TextureId& id) const &;
 
     class Impl;
     const std::unique_ptr<Impl> impl;
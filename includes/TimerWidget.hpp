@@ -99,19 +99,16 @@ public:
 
     /**
      * @brief decrement the timer value
-     *
-     * not noexcept because this method uses SFML methods that are not noexcept
      */
-    void decrementPlayingTimer() const &;
+    void decrementPlayingTimer() const & noexcept;
 
 private:
 
     /**
-     * @brief formats the time displayed string (MM:SS format)
-     *
-     * not noexcept because it calls some SFML methods that are not noexcept
+     * @brief updates the displayed time (MM : SS format); the digits quads
+     * are updated in place, there is no string formatting
      */
-    void updateDisplayedString() const &;
+    void updateDisplayedString() const & noexcept;
 
     class Impl;
     const std::unique_ptr<Impl> impl;
@@ -55,6 +55,13 @@ public:
 
 private:
 
+    /**
+     * @brief switch to the next step of the animation
+     *
+     * not noexcept because it calls SFML methods that are not noexcept
+     */
+    void playNextAnimationStep() const &;
+
     /**
      * @brief replace the left side cells by the right side cells
      *
@@ -82,19 +89,6 @@ private:
      * not noexcept because it calls SFML methods that are not noexcept
      */
     void displayLevelAndVerticalSeparator() const &;
-
-    /**
-     * @brief returns the inverted index of the vertical mirror animation
-     *
-     * @param line the current line
-     * @param index the current index
-     *
-     * @return const unsigned short
-     */
-    const unsigned short findInvertedIndex(
-        const unsigned short& line,
-        const unsigned short& index
-    ) const & noexcept;
 };
 
 }
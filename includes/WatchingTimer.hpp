@@ -76,10 +76,8 @@ public:
     /**
      * @brief decrement the watching timer (the time is not handled
      * by this function individually in order to regroup time management)
-     *
-     * not noexcept because it calls SFML methods that are not noexcept
      */
-    void decrementWatchingTimer() const &;
+    void decrementWatchingTimer() const & noexcept;
 
     /**
      * @brief getter of the watching timer
@@ -0,0 +1,90 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file cells_grid.hpp
+ * @brief mouse hit testing on the regular grids of cells
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_CELLSGRID_H_
+#define MEMORIS_CELLSGRID_H_
+
+namespace sf
+{
+template<typename T>
+class Vector2;
+
+class Transform;
+}
+
+namespace memoris
+{
+namespace utils
+{
+
+/**
+ * @brief a regular grid of cells on the screen (the level floor or the
+ * editor cells selector); the cells are 50 pixels distant and the visible
+ * part of every cell is 49 pixels large
+ */
+struct CellsGrid
+{
+    float left;
+    float top;
+    unsigned short columns;
+    unsigned short rows;
+};
+
+constexpr short NO_GRID_CELL {-1};
+
+/**
+ * @brief returns the current position of the mouse cursor; read once
+ * per frame and shared by all the hit tests of this frame
+ *
+ * @param transform optional transform applied on the grids when they are
+ * drawn, the position is mapped back to the untransformed grids
+ *
+ * @return sf::Vector2<float>
+ *
+ * not noexcept because it calls SFML functions that are not noexcept
+ */
+sf::Vector2<float> getCursorPosition(
+    const sf::Transform* transform = nullptr
+);
+
+/**
+ * @brief returns the index of the grid cell at the given position, lines
+ * after lines, computed from the grid origin and the cells pitch; returns
+ * NO_GRID_CELL if the position is outside of the grid or between two cells
+ *
+ * @param grid the grid to test
+ * @param position the position to test
+ *
+ * @return const short
+ */
+const short getGridCellIndex(
+    const CellsGrid& grid,
+    const sf::Vector2<float>& position
+) noexcept;
+
+}
+}
+
+#endif
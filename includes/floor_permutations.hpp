@@ -0,0 +1,228 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file floor_permutations.hpp
+ * @brief the floors transformations (mirrors, diagonal, rotations) as
+ * permutations of the 256 cells indices of a floor, computed at compile
+ * time; the same tables move the cells of the rendered level and the cells
+ * of the headless game state
+ * @package game
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_FLOORPERMUTATIONS_H_
+#define MEMORIS_FLOORPERMUTATIONS_H_
+
+#include "dimensions.hpp"
+
+namespace memoris
+{
+namespace game
+{
+
+enum class Transformation : unsigned char
+{
+    HorizontalMirror,
+    VerticalMirror,
+    Diagonal,
+    LeftRotation,
+    RightRotation
+};
+
+/* the diagonal animation switches the quarters in two times */
+enum class QuartersSwap : unsigned char
+{
+    TopLeftWithBottomRight,
+    TopRightWithBottomLeft
+};
+
+/**
+ * @brief the destination index of every cell of a floor; every index fits
+ * into one byte, so one table is 256 bytes
+ */
+struct FloorPermutation
+{
+    unsigned char destinations[dimensions::CELLS_PER_FLOOR];
+
+    constexpr const unsigned char& operator[](const unsigned short& index)
+        const noexcept
+    {
+        return destinations[index];
+    }
+};
+
+constexpr unsigned short LAST_LINE_CELL_INDEX {15};
+constexpr unsigned short HALF_CELLS_PER_LINE {8};
+
+/**
+ * @brief returns the destination of a cell on its floor after the given
+ * transformation; the horizontal mirror, the diagonal and the rotations
+ * are applied on every floor, the vertical mirror only on the player floor
+ *
+ * @param transformation the applied transformation
+ * @param index the index of the cell on its floor
+ *
+ * @return unsigned short
+ */
+constexpr unsigned short getTransformedFloorIndex(
+    const Transformation& transformation,
+    const unsigned short& index
+) noexcept
+{
+    using namespace dimensions;
+
+    const unsigned short line = index / CELLS_PER_LINE;
+    const unsigned short column = index % CELLS_PER_LINE;
+
+    switch(transformation)
+    {
+    case Transformation::HorizontalMirror:
+    {
+        return (LAST_LINE_CELL_INDEX - line) * CELLS_PER_LINE + column;
+    }
+    case Transformation::VerticalMirror:
+    {
+        return line * CELLS_PER_LINE + (LAST_LINE_CELL_INDEX - column);
+    }
+    case Transformation::Diagonal:
+    {
+        /* the top left quarter is switched with the bottom right one,
+           the bottom left quarter is switched with the top right one */
+        return ((line + HALF_CELLS_PER_LINE) % CELLS_PER_LINE) *
+            CELLS_PER_LINE + (column + HALF_CELLS_PER_LINE) % CELLS_PER_LINE;
+    }
+    case Transformation::LeftRotation:
+    {
+        return (LAST_LINE_CELL_INDEX - column) * CELLS_PER_LINE + line;
+    }
+    default:
+    {
+        return column * CELLS_PER_LINE + (LAST_LINE_CELL_INDEX - line);
+    }
+    }
+}
+
+/**
+ * @brief returns the destination of a cell on its floor after the given
+ * quarters swap; the cells of the two other quarters do not move
+ *
+ * @param swap the switched quarters
+ * @param index the index of the cell on its floor
+ *
+ * @return unsigned short
+ */
+constexpr unsigned short getSwappedFloorIndex(
+    const QuartersSwap& swap,
+    const unsigned short& index
+) noexcept
+{
+    const bool top = index / dimensions::CELLS_PER_LINE < HALF_CELLS_PER_LINE;
+    const bool left =
+        index % dimensions::CELLS_PER_LINE < HALF_CELLS_PER_LINE;
+
+    if ((top == left) != (swap == QuartersSwap::TopLeftWithBottomRight))
+    {
+        return index;
+    }
+
+    return getTransformedFloorIndex(
+        Transformation::Diagonal,
+        index
+    );
+}
+
+/**
+ * @brief creates the permutation table of the given transformation
+ *
+ * @param transformation the transformation
+ *
+ * @return FloorPermutation
+ */
+constexpr FloorPermutation createFloorPermutation(
+    const Transformation& transformation
+) noexcept
+{
+    FloorPermutation permutation {};
+
+    for (
+        unsigned short index {0};
+        index < dimensions::CELLS_PER_FLOOR;
+        index += 1
+    )
+    {
+        permutation.destinations[index] = static_cast<unsigned char>(
+            getTransformedFloorIndex(transformation, index)
+        );
+    }
+
+    return permutation;
+}
+
+/**
+ * @brief creates the permutation table of the given quarters swap
+ *
+ * @param swap the switched quarters
+ *
+ * @return FloorPermutation
+ */
+constexpr FloorPermutation createFloorPermutation(
+    const QuartersSwap& swap
+) noexcept
+{
+    FloorPermutation permutation {};
+
+    for (
+        unsigned short index {0};
+        index < dimensions::CELLS_PER_FLOOR;
+        index += 1
+    )
+    {
+        permutation.destinations[index] = static_cast<unsigned char>(
+            getSwappedFloorIndex(swap, index)
+        );
+    }
+
+    return permutation;
+}
+
+/**
+ * @brief getter of the precomputed permutation of a transformation
+ *
+ * @param transformation the transformation
+ *
+ * @return const FloorPermutation&
+ */
+const FloorPermutation& getFloorPermutation(
+    const Transformation& transformation
+) noexcept;
+
+/**
+ * @brief getter of the precomputed permutation of a quarters swap
+ *
+ * @param swap the switched quarters
+ *
+ * @return const FloorPermutation&
+ */
+const FloorPermutation& getFloorPermutation(const QuartersSwap& swap)
+    noexcept;
+
+}
+}
+
+#endif
@@ -0,0 +1,168 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file game_state.hpp
+ * @brief the game rules, without any rendering, sound or window; the game
+ * controller forwards the player actions to the rules and renders the
+ * returned events, the rules can also be run headless (levels checks,
+ * simulations)
+ * @package game
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_GAMESTATE_H_
+#define MEMORIS_GAMESTATE_H_
+
+#include "dimensions.hpp"
+#include "floor_permutations.hpp"
+
+#include <array>
+
+namespace memoris
+{
+
+namespace levels
+{
+struct LevelData;
+}
+
+namespace game
+{
+
+constexpr unsigned short FLOORS_PER_LEVEL {10};
+
+enum class Action : unsigned char
+{
+    Up,
+    Down,
+    Left,
+    Right,
+
+    /* one second of playing time is elapsed */
+    Second
+};
+
+enum class Event : unsigned char
+{
+    None,
+    BorderCollision,
+    WallCollision,
+    FoundStar,
+    FoundLife,
+    LostLife,
+    MoreTime,
+    LessTime,
+    FloorUp,
+    FloorDown,
+    HorizontalMirror,
+    VerticalMirror,
+    Diagonal,
+    LeftRotation,
+    RightRotation,
+    Win,
+    TimeOver
+};
+
+enum class Status : unsigned char
+{
+    Playing,
+    Won,
+    Lost
+};
+
+/**
+ * @brief the whole state of one game; this is a plain copyable value,
+ * so states can be stored, compared and explored without any allocation
+ */
+struct GameState
+{
+    std::array<char, dimensions::CELLS_PER_LEVEL> cells;
+
+    unsigned short playerIndex {0};
+    unsigned short floor {0};
+    unsigned short starsAmount {0};
+    unsigned short foundStars {0};
+    unsigned short lifes {0};
+    unsigned short watchingTime {0};
+
+    /* remaining playing time, in seconds */
+    unsigned short remainingTime {0};
+    unsigned short playingTime {0};
+
+    /* false for the levels tested from the editor: the timer is only
+       displayed and the game is never lost when the time is over */
+    bool timeLimited {true};
+
+    Status status {Status::Playing};
+};
+
+/**
+ * @brief the result of one step; the event is the consequence of the
+ * action (the collision, the effect of the reached cell...)
+ */
+struct StepResult
+{
+    Event event {Event::None};
+
+    /* the cell reached by the player movement, or the wall cell
+       that stopped the movement */
+    unsigned short cellIndex {0};
+
+    bool moved {false};
+
+    /* true if the left cell has been emptied (found items and
+       used effects cells are removed when the player leaves them) */
+    bool leftCellEmptied {false};
+};
+
+/**
+ * @brief creates the initial state of a game
+ *
+ * @param data the level to play
+ * @param lifes the lifes amount at the beginning of the game
+ * @param watchingTime the watching time at the beginning of the game
+ * @param timeLimited true if the game is lost when the time is over
+ *
+ * @return GameState
+ */
+GameState createGameState(
+    const levels::LevelData& data,
+    const unsigned short& lifes,
+    const unsigned short& watchingTime,
+    const bool& timeLimited
+) noexcept;
+
+/**
+ * @brief applies one action on the given game state according to the game
+ * rules; does nothing if the game is already won or lost
+ *
+ * @param state the game state to update
+ * @param action the action of the player
+ *
+ * @return StepResult
+ */
+StepResult step(
+    GameState& state,
+    const Action& action
+) noexcept;
+
+}
+}
+
+#endif
@@ -0,0 +1,124 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file level_files.hpp
+ * @brief loads and writes the level files (text and binary formats)
+ * @package levels
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_LEVELFILES_H_
+#define MEMORIS_LEVELFILES_H_
+
+#include "dimensions.hpp"
+
+#include <array>
+#include <string>
+
+namespace memoris
+{
+namespace levels
+{
+
+constexpr const char* TEXT_LEVEL_EXTENSION {".level"};
+constexpr const char* BINARY_LEVEL_EXTENSION {".levelb"};
+
+/**
+ * @brief the content of a level file; this structure does not contain any
+ * SFML object, so it can be loaded and used without any window or context
+ * (levels converter, loading outside of the main thread)
+ */
+struct LevelData
+{
+    unsigned short minutes {0};
+    unsigned short seconds {0};
+    unsigned short starsAmount {0};
+    unsigned short departureIndex {0};
+    unsigned short lastPlayableFloor {0};
+
+    std::array<char, dimensions::CELLS_PER_LEVEL> cells;
+};
+
+/**
+ * @brief loads the level with the given path, without extension; the binary
+ * file is used if it exists and if it is newer than the text file, the
+ * text file is parsed otherwise
+ *
+ * @param path the level file path without extension
+ *
+ * @return LevelData
+ *
+ * @throw std::invalid_argument the level file cannot be opened;
+ * this exception is caught into the controllers factory
+ * and display an error message to the screen
+ */
+LevelData loadLevelFile(const std::string& path);
+
+/**
+ * @brief parses a text level file (two lines for the minutes and
+ * the seconds, then one character per cell)
+ *
+ * @param filePath the text level file path (full path)
+ *
+ * @return LevelData
+ *
+ * @throw std::invalid_argument the level file cannot be opened
+ * or the time lines are invalid
+ */
+LevelData loadTextLevelFile(const std::string& filePath);
+
+/**
+ * @brief loads a binary level file; the file is mapped in memory and the
+ * cells are directly copied, there is no parsing at all
+ *
+ * @param filePath the binary level file path (full path)
+ *
+ * @return LevelData
+ *
+ * @throw std::invalid_argument the level file cannot be opened,
+ * has an unexpected size or an unexpected version
+ */
+LevelData loadBinaryLevelFile(const std::string& filePath);
+
+/**
+ * @brief writes the given level into a binary level file; creates the file
+ * or overwrites the existing one
+ *
+ * @param filePath the binary level file path (full path)
+ * @param data the level to write
+ *
+ * @throw std::invalid_argument the level file cannot be written
+ */
+void writeBinaryLevelFile(
+    const std::string& filePath,
+    const LevelData& data
+);
+
+/**
+ * @brief calculates the stars amount, the departure index and the last
+ * playable floor of the level according to its cells
+ *
+ * @param data the level to update
+ */
+void updateLevelDataCounters(LevelData& data) noexcept;
+
+}
+}
+
+#endif
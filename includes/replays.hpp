@@ -0,0 +1,121 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file replays.hpp
+ * @brief records the actions of a game with their time, writes and loads
+ * the replay files and plays them without any window
+ * @package replays
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_REPLAYS_H_
+#define MEMORIS_REPLAYS_H_
+
+#include "level_files.hpp"
+#include "game_state.hpp"
+
+#include <string>
+#include <vector>
+
+namespace memoris
+{
+namespace replays
+{
+
+constexpr const char* LAST_REPLAY_FILE_PATH {"data/replays/last.replay"};
+
+struct ReplayStep
+{
+    /* milliseconds since the beginning of the game */
+    unsigned int time {0};
+
+    game::Action action {game::Action::Second};
+};
+
+/**
+ * @brief everything required to play exactly the same game again: the
+ * level, the initial counters and the actions of the player
+ */
+struct Replay
+{
+    levels::LevelData level;
+
+    unsigned short lifes {0};
+    unsigned short watchingTime {0};
+
+    /* the watching time displayed at the beginning of the game, 0 if the
+       game starts without watching period (level tested from the editor) */
+    unsigned short displayedWatchingTime {0};
+
+    /* the game status at the end of the recording */
+    game::Status status {game::Status::Playing};
+
+    std::vector<ReplayStep> steps;
+};
+
+/**
+ * @brief creates the initial game state of the replay
+ *
+ * @param replay the replay to play
+ *
+ * @return game::GameState
+ */
+game::GameState createReplayGameState(const Replay& replay) noexcept;
+
+/**
+ * @brief plays all the actions of the replay as fast as possible,
+ * without any rendering
+ *
+ * @param replay the replay to play
+ *
+ * @return game::GameState the state at the end of the replay
+ */
+game::GameState playReplay(const Replay& replay) noexcept;
+
+/**
+ * @brief writes the replay into a file; the times are stored as
+ * differences with the previous step, packed with the action into
+ * variable length integers (one or two bytes for most of the steps)
+ *
+ * @param filePath the replay file path
+ * @param replay the replay to write
+ *
+ * @throw std::invalid_argument the replay file cannot be written
+ */
+void writeReplayFile(
+    const std::string& filePath,
+    const Replay& replay
+);
+
+/**
+ * @brief loads a replay file
+ *
+ * @param filePath the replay file path
+ *
+ * @return Replay
+ *
+ * @throw std::invalid_argument the replay file cannot be opened,
+ * has an unexpected version or is truncated
+ */
+Replay loadReplayFile(const std::string& filePath);
+
+}
+}
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * @file resource_pack.hpp
+ * @brief reads and writes the resources pack, one file containing every
+ * picture, font and sound of the game; the pack is generated at build time
+ * and is mapped in memory when the game starts
+ * @package resources
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_RESOURCEPACK_H_
+#define MEMORIS_RESOURCEPACK_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace memoris
+{
+namespace resources
+{
+
+constexpr const char* RESOURCE_PACK_PATH {"res/resources.pack"};
+
+/**
+ * @brief the bytes of one packed resource; the bytes belong to the pack
+ * mapping and are valid as long as the pack exists
+ */
+struct ResourceData
+{
+    const char* bytes {nullptr};
+    std::size_t size {0};
+};
+
+/**
+ * @brief the mapped pack and the position of every resource into it; the
+ * resources are indexed by their path into the resources directory
+ * (images/star.png, fonts/hi.otf...)
+ */
+struct ResourcePack
+{
+    /* unmaps the file when the last copy of the pack is destroyed */
+    std::shared_ptr<const char> mapping;
+
+    std::map<std::string, ResourceData> resources;
+};
+
+/**
+ * @brief maps the given pack file in memory and reads its index; the
+ * resources are not copied
+ *
+ * @param filePath the resources pack path
+ *
+ * @return ResourcePack
+ *
+ * @throw std::invalid_argument the pack cannot be opened, cannot be mapped
+ * or has an unexpected version
+ */
+ResourcePack mapResourcePack(const std::string& filePath);
+
+/**
+ * @brief returns the bytes of the given resource
+ *
+ * @param pack the pack containing the resource
+ * @param name the resource path into the resources directory
+ *
+ * @return const ResourceData&
+ *
+ * @throw std::invalid_argument the resource is not into the pack
+ */
+const ResourceData& getResource(
+    const ResourcePack& pack,
+    const std::string& name
+);
+
+/**
+ * @brief writes the given resources files into one pack; creates the pack
+ * or overwrites the existing one
+ *
+ * @param filePath the resources pack path
+ * @param directory the resources directory
+ * @param names the resources paths into the resources directory
+ *
+ * @throw std::invalid_argument one resource cannot be read, its name is too
+ * long or the pack cannot be written
+ */
+void writeResourcePack(
+    const std::string& filePath,
+    const std::string& directory,
+    const std::vector<std::string>& names
+);
+
+}
+}
+
+#endif
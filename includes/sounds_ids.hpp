@@ -0,0 +1,53 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * @file sounds_ids.hpp
+ * @brief enumeration with all the sounds effects
+ * @package sounds
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#ifndef MEMORIS_SOUNDSIDS_H_
+#define MEMORIS_SOUNDSIDS_H_
+
+namespace memoris
+{
+namespace sounds
+{
+
+/* the order of the ids is the order of the sounds files numbers */
+enum class SoundId
+{
+    MoveSelector,
+    ScreenTransition,
+    HideLevel,
+    FoundStar,
+    FoundLifeOrTime,
+    FoundDeadOrLessTime,
+    Collision,
+    FloorSwitch,
+    TimeOver,
+    MirrorAnimation,
+    WinLevel,
+    FloorMovementAnimation
+};
+
+}
+}
+
+#endif
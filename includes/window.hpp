@@ -45,6 +45,9 @@ constexpr float WIDTH {1600.f};
 
 constexpr unsigned int HEIGHT {900};
 
+/* prevent intensive CPU usage */
+constexpr unsigned int FPS_LIMIT {60};
+
 /**
  * @brief returns the expected horizontal position
  * when a surface must be centered
@@ -23,6 +23,7 @@
  */
 
 #include "AbstractForeground.hpp"
+#include "ProfiledWindow.hpp"
 
 namespace memoris
 {
@@ -34,18 +35,18 @@ class AbstractForeground::Impl
 
 public:
 
-    Impl(sf::RenderWindow& window) :
+    Impl(utils::ProfiledWindow& window) :
         window(window)
     {
     }
 
-    sf::RenderWindow& window;
+    utils::ProfiledWindow& window;
 };
 
 /**
  *
  */
-AbstractForeground::AbstractForeground(sf::RenderWindow& window) :
+AbstractForeground::AbstractForeground(utils::ProfiledWindow& window) :
     impl(std::make_unique<Impl>(window))
 {
 }
@@ -58,7 +59,7 @@ AbstractForeground::~AbstractForeground() = default;
 /**
  *
  */
-sf::RenderWindow& AbstractForeground::getWindow() const & noexcept
+utils::ProfiledWindow& AbstractForeground::getWindow() const & noexcept
 {
     return impl->window;
 }
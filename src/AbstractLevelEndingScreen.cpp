@@ -28,8 +28,8 @@
 #include "Context.hpp"
 #include "ColorsManager.hpp"
 #include "FontsManager.hpp"
+#include "ProfiledWindow.hpp"
 
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 
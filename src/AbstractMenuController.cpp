@@ -58,6 +58,18 @@ AbstractMenuController::AbstractMenuController(const utils::Context& context) :
  */
 AbstractMenuController::~AbstractMenuController() = default;
 
+/**
+ *
+ */
+void AbstractMenuController::reset() const &
+{
+    Controller::reset();
+
+    impl->selectorPosition = 0;
+
+    updateMenuSelection();
+}
+
 /**
  *
  */
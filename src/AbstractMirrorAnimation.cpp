@@ -25,7 +25,9 @@
 #include "AbstractMirrorAnimation.hpp"
 
 #include "Level.hpp"
-#include "Cell.hpp"
+#include "dimensions.hpp"
+
+#include <vector>
 
 namespace memoris
 {
@@ -33,13 +35,25 @@ namespace animations
 {
 
 constexpr float TRANSPARENCY_INTERVAL {51.f};
+constexpr sf::Int32 ANIMATION_STEPS_INTERVAL {50};
 
 class AbstractMirrorAnimation::Impl
 {
 
 public:
 
+    Impl()
+    {
+        fadedCells.reserve(dimensions::CELLS_PER_FLOOR);
+    }
+
     sf::Uint8 animatedSideTransparency {255};
+    sf::Uint8 previousTransparency {255};
+
+    /* true when the current step fades the cells of one side */
+    bool fading {false};
+
+    std::vector<unsigned short> fadedCells;
 };
 
 /**
@@ -53,7 +67,9 @@ AbstractMirrorAnimation::AbstractMirrorAnimation(
     LevelAnimation(
         context,
         level,
-        floor
+        floor,
+        ANIMATION_STEPS_INTERVAL,
+        FirstStep::Immediate
     ),
     impl(std::make_unique<Impl>())
 {
@@ -69,7 +85,9 @@ AbstractMirrorAnimation::~AbstractMirrorAnimation() = default;
  */
 void AbstractMirrorAnimation::increaseTransparency() const & noexcept
 {
+    impl->previousTransparency = impl->animatedSideTransparency;
     impl->animatedSideTransparency += TRANSPARENCY_INTERVAL;
+    impl->fading = true;
 }
 
 /**
@@ -77,7 +95,9 @@ void AbstractMirrorAnimation::increaseTransparency() const & noexcept
  */
 void AbstractMirrorAnimation::decreaseTransparency() const & noexcept
 {
+    impl->previousTransparency = impl->animatedSideTransparency;
     impl->animatedSideTransparency -= TRANSPARENCY_INTERVAL;
+    impl->fading = true;
 }
 
 /**
@@ -104,10 +124,64 @@ void AbstractMirrorAnimation::applyTransparencyOnOneCell(
     const unsigned short& index
 ) const &
 {
-    getLevel()->getCells()[index]->setCellColorTransparency(
-        getContext(),
+    getLevel()->setCellColorTransparency(
+        index,
         impl->animatedSideTransparency
     );
+
+    if (impl->fading)
+    {
+        impl->fadedCells.push_back(index);
+    }
+}
+
+/**
+ *
+ */
+void AbstractMirrorAnimation::startTransparencyStep() const &
+{
+    if (not impl->fading)
+    {
+        return;
+    }
+
+    const auto& level = getLevel();
+
+    for (const auto& index : impl->fadedCells)
+    {
+        level->setCellColorTransparency(
+            index,
+            impl->animatedSideTransparency
+        );
+    }
+
+    impl->fadedCells.clear();
+    impl->fading = false;
+}
+
+/**
+ *
+ */
+void AbstractMirrorAnimation::interpolateTransparency() const &
+{
+    if (not impl->fading)
+    {
+        return;
+    }
+
+    const float previous = impl->previousTransparency;
+    const float current = impl->animatedSideTransparency;
+
+    const auto transparency = static_cast<sf::Uint8>(
+        previous + (current - previous) * getStepInterpolation()
+    );
+
+    const auto& level = getLevel();
+
+    for (const auto& index : impl->fadedCells)
+    {
+        level->setCellColorTransparency(index, transparency);
+    }
 }
 
 }
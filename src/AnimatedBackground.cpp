@@ -25,19 +25,34 @@
 #include "AnimatedBackground.hpp"
 
 #include "cells.hpp"
-#include "Cell.hpp"
 #include "Context.hpp"
+#include "CellsTexturesManager.hpp"
+#include "ProfiledWindow.hpp"
 
-#include <SFML/Graphics/Transform.hpp>
-#include <SFML/System.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
 
-#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
 
 namespace memoris
 {
 namespace utils
 {
 
+constexpr float CELL_PIXELS_DIMENSIONS {49.f};
+constexpr float CELLS_PIXELS_SEPARATION {1.f};
+constexpr float CELLS_PIXELS_INTERVAL {
+    CELL_PIXELS_DIMENSIONS + CELLS_PIXELS_SEPARATION
+};
+
+/* the cells columns scroll on a loop of 33 columns, a bit more than
+   the window width; the columns are stored twice (one loop on the left
+   of the other one), so the whole window is always covered */
+constexpr unsigned short COLUMNS_PER_LOOP {33};
+constexpr float LOOP_WIDTH {COLUMNS_PER_LOOP * CELLS_PIXELS_INTERVAL};
+
 class AnimatedBackground::Impl
 {
 
@@ -48,9 +63,14 @@ public:
     {
     }
 
-    std::vector<std::unique_ptr<entities::Cell>> cells;
+    /* all the cells are quads of one vertex array textured with the cells
+       atlas: the background is one draw call, the scrolling is one
+       translation of the whole array */
+    sf::VertexArray vertices {sf::Quads};
 
-    sf::Uint32 cellsMovementLastAnimation {0};
+    float scrolling {0.f};
+
+    sf::Int32 lastUpdateTime {0};
 
     const utils::Context& context;
 };
@@ -78,34 +98,38 @@ void AnimatedBackground::render() const &
 {
     const auto& context = impl->context;
 
-    const auto& currentTime = context.getClockMillisecondsTime();
-    auto& lastTime = impl->cellsMovementLastAnimation;
-
-    auto& cells = impl->cells;
-
-    auto moveCells = false;
+    const auto currentTime = context.getClockMillisecondsTime();
+    auto& lastTime = impl->lastUpdateTime;
 
-    constexpr sf::Uint32 ANIMATION_INTERVAL {10};
-    if(currentTime - lastTime > ANIMATION_INTERVAL)
+    /* the clock is restarted when the controller changes */
+    if (currentTime > lastTime)
     {
-        /* use an intermediate boolean in order
-           to avoid two browsing procedures */
-        moveCells = true;
-
-        lastTime = currentTime;
+        /* the speed depends on the elapsed time and not on the frames rate,
+           60 pixels per second is the speed of the former 1 pixel per
+           frame movement at 60 frames per second */
+        constexpr float PIXELS_PER_MILLISECOND {0.06f};
+
+        auto& scrolling = impl->scrolling;
+        scrolling = std::fmod(
+            scrolling + (currentTime - lastTime) * PIXELS_PER_MILLISECOND,
+            LOOP_WIDTH
+        );
     }
 
-    for(const auto& cell : cells)
-    {
-        const auto& cellObject = *cell;
+    lastTime = currentTime;
 
-        if (moveCells)
-        {
-            cellObject.moveHorizontally();
-        }
+    sf::RenderStates states(
+        &context.getCellsTexturesManager().getAtlasTexture()
+    );
+    states.transform.translate(
+        impl->scrolling,
+        0.f
+    );
 
-        cellObject.display(context);
-    }
+    context.getSfmlWindow().draw(
+        impl->vertices,
+        states
+    );
 }
 
 /**
@@ -120,6 +144,8 @@ void AnimatedBackground::initializeCells() const &
 
     constexpr unsigned short BACKGROUND_CELLS_AMOUNT {575};
 
+    const auto& texturesManager = impl->context.getCellsTexturesManager();
+
     for (
         unsigned short index {0};
         index < BACKGROUND_CELLS_AMOUNT;
@@ -142,27 +168,72 @@ void AnimatedBackground::initializeCells() const &
             continue;
         }
 
-        constexpr float CELL_PIXELS_DIMENSIONS {49.f};
-        constexpr float CELLS_PIXELS_SEPARATION {1.f};
-        auto cell = std::make_unique<entities::Cell>(
-            impl->context,
-            currentColumn *
-            (
-                CELL_PIXELS_DIMENSIONS +
-                CELLS_PIXELS_SEPARATION
-            ),
-            currentLine *
-            (
-                CELL_PIXELS_DIMENSIONS +
-                CELLS_PIXELS_SEPARATION
-            ),
-            cellType
+        const auto rect =
+            texturesManager.getAtlasTextureRectByCellType(cellType);
+
+        const float horizontalPosition =
+            (currentColumn % COLUMNS_PER_LOOP) * CELLS_PIXELS_INTERVAL;
+
+        appendCell(
+            horizontalPosition,
+            currentLine * CELLS_PIXELS_INTERVAL,
+            rect
         );
 
-        impl->cells.push_back(std::move(cell));
+        appendCell(
+            horizontalPosition - LOOP_WIDTH,
+            currentLine * CELLS_PIXELS_INTERVAL,
+            rect
+        );
     }
 }
 
+/**
+ *
+ */
+void AnimatedBackground::appendCell(
+    const float& horizontalPosition,
+    const float& verticalPosition,
+    const sf::IntRect& rect
+) const &
+{
+    const float left = horizontalPosition;
+    const float top = verticalPosition;
+    const float right = left + CELL_PIXELS_DIMENSIONS;
+    const float bottom = top + CELL_PIXELS_DIMENSIONS;
+
+    const auto textureLeft = static_cast<float>(rect.left);
+    const auto textureTop = static_cast<float>(rect.top);
+    const auto textureRight = static_cast<float>(rect.left + rect.width);
+    const auto textureBottom = static_cast<float>(rect.top + rect.height);
+
+    auto& vertices = impl->vertices;
+    vertices.append(
+        sf::Vertex(
+            sf::Vector2f(left, top),
+            sf::Vector2f(textureLeft, textureTop)
+        )
+    );
+    vertices.append(
+        sf::Vertex(
+            sf::Vector2f(right, top),
+            sf::Vector2f(textureRight, textureTop)
+        )
+    );
+    vertices.append(
+        sf::Vertex(
+            sf::Vector2f(right, bottom),
+            sf::Vector2f(textureRight, textureBottom)
+        )
+    );
+    vertices.append(
+        sf::Vertex(
+            sf::Vector2f(left, bottom),
+            sf::Vector2f(textureLeft, textureBottom)
+        )
+    );
+}
+
 /**
  *
  */
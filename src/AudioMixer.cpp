@@ -0,0 +1,348 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * @file AudioMixer.cpp
+ * @package sounds
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "AudioMixer.hpp"
+
+#include "sounds_ids.hpp"
+#include "ResourcesLoader.hpp"
+#include "resource_pack.hpp"
+
+#include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string>
+
+namespace memoris
+{
+namespace sounds
+{
+
+/* the sounds files of the pack, in the order of the sounds ids */
+constexpr const char* SOUNDS_FILES[] {
+    "sounds/001.wav",
+    "sounds/002.wav",
+    "sounds/003.wav",
+    "sounds/004.wav",
+    "sounds/005.wav",
+    "sounds/006.wav",
+    "sounds/007.wav",
+    "sounds/008.wav",
+    "sounds/009.wav",
+    "sounds/010.wav",
+    "sounds/011.wav",
+    "sounds/012.wav"
+};
+
+constexpr std::size_t SOUNDS_AMOUNT {
+    sizeof(SOUNDS_FILES) / sizeof(const char*)
+};
+
+static_assert(
+    static_cast<std::size_t>(SoundId::FloorMovementAnimation) + 1 ==
+        SOUNDS_AMOUNT,
+    "every sound id must have one sound file"
+);
+
+/* the higher priorities are the end of level sounds, then the sounds of
+   the player actions; the menus sounds can always be stopped */
+constexpr unsigned short SOUNDS_PRIORITIES[] {
+    0, /* move selector */
+    1, /* screen transition */
+    1, /* hide level */
+    2, /* found star */
+    2, /* found life or time */
+    2, /* found dead or less time */
+    2, /* collision */
+    1, /* floor switch */
+    3, /* time over */
+    1, /* mirror animation */
+    3, /* win level */
+    1  /* floor movement animation */
+};
+
+static_assert(
+    sizeof(SOUNDS_PRIORITIES) / sizeof(unsigned short) == SOUNDS_AMOUNT,
+    "every sound id must have one priority"
+);
+
+/* every voice is bound to one sound buffer once for all, binding a buffer
+   to a voice allocates memory into SFML */
+constexpr std::size_t VOICES_PER_SOUND {3};
+constexpr std::size_t VOICES_AMOUNT {SOUNDS_AMOUNT * VOICES_PER_SOUND};
+
+constexpr std::size_t MAXIMUM_PLAYING_VOICES {8};
+
+class AudioMixer::Impl
+{
+
+public:
+
+    Impl(const utils::ResourcesLoader& loader) :
+        loader(loader)
+    {
+    }
+
+    const utils::ResourcesLoader& loader;
+
+    /* the buffers are never modified after loading and are shared
+       by the voices of the same sound; a buffer is decoded when its sound
+       is expected by the next controller */
+    std::array<std::shared_ptr<const sf::SoundBuffer>, SOUNDS_AMOUNT> buffers;
+
+    /* the sounds that are not into the pack are never decoded again */
+    std::array<bool, SOUNDS_AMOUNT> unavailableSounds {};
+
+    std::array<sf::Sound, VOICES_AMOUNT> voices;
+
+    /* the play number of the last start of every voice,
+       the oldest voice has the lowest number */
+    std::array<unsigned long, VOICES_AMOUNT> voicesStarts {};
+
+    unsigned long playsAmount {0};
+};
+
+/**
+ *
+ */
+AudioMixer::AudioMixer(const utils::ResourcesLoader& loader) :
+    impl(std::make_unique<Impl>(loader))
+{
+}
+
+/**
+ *
+ */
+AudioMixer::~AudioMixer() = default;
+
+/**
+ *
+ */
+void AudioMixer::play(const SoundId& id) const &
+{
+    const auto sound = static_cast<std::size_t>(id);
+
+    /* the sounds are only decoded by preload(), before the controller
+       creation; a sound that is not expected is not played */
+    if (impl->buffers[sound] == nullptr)
+    {
+        return;
+    }
+
+    auto& voices = impl->voices;
+    auto& voicesStarts = impl->voicesStarts;
+
+    /* the free voice of the sound, its oldest voice otherwise */
+    const auto firstVoice = sound * VOICES_PER_SOUND;
+    auto selectedVoice = firstVoice;
+
+    for (
+        auto voice = firstVoice;
+        voice < firstVoice + VOICES_PER_SOUND;
+        voice += 1
+    )
+    {
+        if (voices[voice].getStatus() != sf::Sound::Playing)
+        {
+            selectedVoice = voice;
+
+            break;
+        }
+
+        if (voicesStarts[voice] < voicesStarts[selectedVoice])
+        {
+            selectedVoice = voice;
+        }
+    }
+
+    if (voices[selectedVoice].getStatus() != sf::Sound::Playing)
+    {
+        std::size_t playingVoicesAmount {0};
+        auto stolenVoice = VOICES_AMOUNT;
+
+        for (
+            std::size_t voice {0};
+            voice < VOICES_AMOUNT;
+            voice += 1
+        )
+        {
+            if (voices[voice].getStatus() != sf::Sound::Playing)
+            {
+                continue;
+            }
+
+            playingVoicesAmount += 1;
+
+            const auto& priority =
+                SOUNDS_PRIORITIES[voice / VOICES_PER_SOUND];
+
+            if (
+                stolenVoice == VOICES_AMOUNT or
+                priority < SOUNDS_PRIORITIES[stolenVoice / VOICES_PER_SOUND] or
+                (
+                    priority ==
+                        SOUNDS_PRIORITIES[stolenVoice / VOICES_PER_SOUND] and
+                    voicesStarts[voice] < voicesStarts[stolenVoice]
+                )
+            )
+            {
+                stolenVoice = voice;
+            }
+        }
+
+        if (playingVoicesAmount >= MAXIMUM_PLAYING_VOICES)
+        {
+            if (
+                SOUNDS_PRIORITIES[stolenVoice / VOICES_PER_SOUND] >
+                SOUNDS_PRIORITIES[sound]
+            )
+            {
+                return;
+            }
+
+            voices[stolenVoice].stop();
+        }
+    }
+
+    /* playing a playing voice restarts it from the beginning */
+    impl->playsAmount += 1;
+    voicesStarts[selectedVoice] = impl->playsAmount;
+
+    voices[selectedVoice].play();
+}
+
+/**
+ *
+ */
+void AudioMixer::preload(const std::vector<SoundId>& expectedSounds) const &
+{
+    for (
+        std::size_t sound {0};
+        sound < SOUNDS_AMOUNT;
+        sound += 1
+    )
+    {
+        const bool expected = std::find(
+            expectedSounds.cbegin(),
+            expectedSounds.cend(),
+            static_cast<SoundId>(sound)
+        ) != expectedSounds.cend();
+
+        if (not expected)
+        {
+            releaseSound(sound);
+        }
+        else if (impl->buffers[sound] == nullptr)
+        {
+            loadSound(sound);
+        }
+    }
+}
+
+/**
+ *
+ */
+void AudioMixer::loadSound(const std::size_t& sound) const &
+{
+    auto& unavailable = impl->unavailableSounds[sound];
+
+    if (unavailable)
+    {
+        return;
+    }
+
+    auto buffer = std::make_shared<sf::SoundBuffer>();
+
+    try
+    {
+        const auto& data = impl->loader.getResource(SOUNDS_FILES[sound]);
+
+        if (not buffer->loadFromMemory(data.bytes, data.size))
+        {
+            unavailable = true;
+
+            return;
+        }
+    }
+    catch(std::invalid_argument&)
+    {
+        /* TODO: #1006 the sounds files are not added yet */
+        unavailable = true;
+
+        return;
+    }
+
+    impl->buffers[sound] = buffer;
+
+    for (
+        std::size_t voice {0};
+        voice < VOICES_PER_SOUND;
+        voice += 1
+    )
+    {
+        impl->voices[sound * VOICES_PER_SOUND + voice].setBuffer(*buffer);
+    }
+}
+
+/**
+ *
+ */
+void AudioMixer::releaseSound(const std::size_t& sound) const &
+{
+    if (impl->buffers[sound] == nullptr)
+    {
+        return;
+    }
+
+    const auto firstVoice = sound * VOICES_PER_SOUND;
+    auto& voices = impl->voices;
+
+    for (
+        auto voice = firstVoice;
+        voice < firstVoice + VOICES_PER_SOUND;
+        voice += 1
+    )
+    {
+        /* the sound is released by a next controller change */
+        if (voices[voice].getStatus() == sf::Sound::Playing)
+        {
+            return;
+        }
+    }
+
+    for (
+        auto voice = firstVoice;
+        voice < firstVoice + VOICES_PER_SOUND;
+        voice += 1
+    )
+    {
+        voices[voice].resetBuffer();
+    }
+
+    impl->buffers[sound].reset();
+}
+
+}
+}
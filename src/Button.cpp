@@ -26,8 +26,8 @@
 
 #include "ColorsManager.hpp"
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
 
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/System/Vector2.hpp>
@@ -50,9 +50,11 @@ public:
     Impl(
         const utils::Context& context,
         const float& horizontalPosition,
-        const float& verticalPosition
+        const float& verticalPosition,
+        const std::shared_ptr<const sf::Texture>& texture
     ) :
         context(context),
+        texture(texture),
         horizontalPosition(horizontalPosition),
         verticalPosition(verticalPosition)
     {
@@ -60,6 +62,8 @@ public:
 
     const utils::Context& context;
 
+    const std::shared_ptr<const sf::Texture> texture;
+
     sf::RectangleShape back;
     sf::RectangleShape left;
     sf::RectangleShape right;
@@ -81,13 +85,14 @@ Button::Button(
     const utils::Context& context,
     const float& hPosition,
     const float& vPosition,
-    const sf::Texture& texture
+    const std::shared_ptr<const sf::Texture>& texture
 ) :
 impl(
     std::make_unique<Impl>(
         context,
         hPosition,
-        vPosition
+        vPosition,
+        texture
     )
 )
 {
@@ -154,7 +159,7 @@ impl(
     );
 
     auto& icon = impl->icon;
-    icon.setTexture(texture);
+    icon.setTexture(*texture);
 
     constexpr float ICON_POSITION_OFFSET {3.f};
     icon.setPosition(
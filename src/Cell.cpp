@@ -25,15 +25,13 @@
 
 #include "Cell.hpp"
 
-#include "window.hpp"
 #include "cells.hpp"
 #include "ColorsManager.hpp"
 #include "CellsTexturesManager.hpp"
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
 
 #include <SFML/Graphics/Sprite.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
-#include <SFML/Window/Mouse.hpp>
 
 namespace memoris
 {
@@ -86,6 +84,10 @@ Cell::Cell(
         )
     )
 {
+    impl->sprite.setTexture(
+        context.getCellsTexturesManager().getAtlasTexture()
+    );
+
     setPosition(
         hPosition,
         vPosition
@@ -108,27 +110,6 @@ Cell::Cell(const Cell& cell) : impl(std::make_unique<Impl>(*cell.impl))
  */
 Cell::~Cell() = default;
 
-/**
- *
- */
-void Cell::moveHorizontally() const &
-{
-    auto& horizontalPosition = impl->horizontalPosition;
-
-    horizontalPosition += 1;
-
-    if (horizontalPosition > memoris::window::WIDTH)
-    {
-        constexpr float ANIMATED_CELL_HORIZONTAL_POSITION {-50.f};
-        horizontalPosition = ANIMATED_CELL_HORIZONTAL_POSITION;
-    }
-
-    setPosition(
-        horizontalPosition,
-        impl->verticalPosition
-    );
-}
-
 /**
  *
  */
@@ -231,12 +212,14 @@ void Cell::display(
 /**
  *
  */
-void Cell::displayWithMouseHover(const utils::Context& context) const &
+void Cell::displayWithMouseHover(
+    const utils::Context& context,
+    const bool& isMouseHover
+) const &
 {
     auto& highlight = impl->highlight;
     auto& sprite = impl->sprite;
     const auto& colorsManager = context.getColorsManager();
-    const bool isMouseHover = this->isMouseHover();
 
     if (
         isMouseHover and
@@ -265,8 +248,8 @@ void Cell::displayWithMouseHover(const utils::Context& context) const &
  */
 void Cell::hide(const utils::Context& context) const &
 {
-    impl->sprite.setTexture(
-        context.getCellsTexturesManager().getTextureReferenceByCellType(
+    impl->sprite.setTextureRect(
+        context.getCellsTexturesManager().getAtlasTextureRectByCellType(
             cells::HIDDEN_CELL
         )
     );
@@ -282,8 +265,8 @@ void Cell::show(
     const sf::Uint8& transparency
 ) const &
 {
-    impl->sprite.setTexture(
-        context.getCellsTexturesManager().getTextureReferenceByCellType(
+    impl->sprite.setTextureRect(
+        context.getCellsTexturesManager().getAtlasTextureRectByCellType(
             impl->type
         )
     );
@@ -358,30 +341,6 @@ void Cell::setIsVisible(const bool& visibility) const & noexcept
     impl->visible = visibility;
 }
 
-/**
- *
- */
-const bool Cell::isMouseHover() const &
-{
-    sf::Vector2<int> cursorPosition = sf::Mouse::getPosition();
-
-    const auto& horizontal = static_cast<int>(impl->horizontalPosition);
-    const auto& vertical = static_cast<int>(impl->verticalPosition);
-
-    constexpr float CELL_DIMENSION {49.f};
-    if (
-        cursorPosition.x > horizontal &&
-        cursorPosition.x < horizontal + CELL_DIMENSION &&
-        cursorPosition.y > vertical &&
-        cursorPosition.y < vertical + CELL_DIMENSION
-    )
-    {
-        return true;
-    }
-
-    return false;
-}
-
 /**
  *
  */
@@ -28,15 +28,47 @@
 #include "Cell.hpp"
 #include "cells.hpp"
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
+#include "cells_grid.hpp"
 
 #include <SFML/Graphics/Sprite.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
 
 namespace memoris
 {
 namespace utils
 {
 
+constexpr unsigned short SELECTOR_COLUMNS {2};
+constexpr unsigned short SELECTOR_ROWS {15};
+
+/* the selector cells are displayed on two columns, from the top left
+   corner of the selector */
+constexpr CellsGrid SELECTOR_GRID {
+    150.f,
+    98.f,
+    SELECTOR_COLUMNS,
+    SELECTOR_ROWS
+};
+
+/* the types of the selector cells, lines after lines */
+constexpr char SELECTOR_CELLS_TYPES[SELECTOR_COLUMNS * SELECTOR_ROWS] {
+    cells::EMPTY_CELL, cells::ELEVATOR_UP_CELL,
+    cells::DEPARTURE_CELL, cells::ELEVATOR_DOWN_CELL,
+    cells::ARRIVAL_CELL, cells::DIAGONAL_CELL,
+    cells::STAR_CELL, cells::NO_CELL,
+    cells::MORE_LIFE_CELL, cells::NO_CELL,
+    cells::LESS_LIFE_CELL, cells::NO_CELL,
+    cells::MORE_TIME_CELL, cells::NO_CELL,
+    cells::LESS_TIME_CELL, cells::NO_CELL,
+    cells::WALL_CELL, cells::NO_CELL,
+    cells::STAIRS_UP_CELL, cells::NO_CELL,
+    cells::STAIRS_DOWN_CELL, cells::NO_CELL,
+    cells::HORIZONTAL_MIRROR_CELL, cells::NO_CELL,
+    cells::VERTICAL_MIRROR_CELL, cells::NO_CELL,
+    cells::LEFT_ROTATION_CELL, cells::NO_CELL,
+    cells::RIGHT_ROTATION_CELL, cells::NO_CELL
+};
+
 class CellsSelector::Impl
 {
 
@@ -153,10 +185,11 @@ public:
             cells::DIAGONAL_CELL
         )
     {
-        selectedCellImage.setTexture(
-            context.getCellsTexturesManager().getTextureReferenceByCellType(
-                cells::EMPTY_CELL
-            )
+        const auto& texturesManager = context.getCellsTexturesManager();
+
+        selectedCellImage.setTexture(texturesManager.getAtlasTexture());
+        selectedCellImage.setTextureRect(
+            texturesManager.getAtlasTextureRectByCellType(cells::EMPTY_CELL)
         );
 
         constexpr float SELECTED_CELL_IMAGE_HORIZONTAL_POSITION {150.f};
@@ -213,24 +246,38 @@ void CellsSelector::display() const &
 {
     const auto& context = impl->context;
 
-    impl->emptyCell.displayWithMouseHover(context);
-    impl->departureCell.displayWithMouseHover(context);
-    impl->arrivalCell.displayWithMouseHover(context);
-    impl->starCell.displayWithMouseHover(context);
-    impl->moreLifeCell.displayWithMouseHover(context);
-    impl->lessLifeCell.displayWithMouseHover(context);
-    impl->moreTimeCell.displayWithMouseHover(context);
-    impl->lessTimeCell.displayWithMouseHover(context);
-    impl->wallCell.displayWithMouseHover(context);
-    impl->stairsUpCell.displayWithMouseHover(context);
-    impl->stairsDownCell.displayWithMouseHover(context);
-    impl->horizontalMirrorCell.displayWithMouseHover(context);
-    impl->verticalMirrorCell.displayWithMouseHover(context);
-    impl->leftRotationCell.displayWithMouseHover(context);
-    impl->rightRotationCell.displayWithMouseHover(context);
-    impl->elevatorUpCell.displayWithMouseHover(context);
-    impl->elevatorDownCell.displayWithMouseHover(context);
-    impl->diagonalCell.displayWithMouseHover(context);
+    /* the hover cell is found once, instead of testing the mouse position
+       on every cell of the selector */
+    const char mouseHoverCellType = getMouseHoverCellType();
+
+    const auto displayCell = [&context, &mouseHoverCellType](
+        const entities::Cell& cell
+    )
+    {
+        cell.displayWithMouseHover(
+            context,
+            cell.getType() == mouseHoverCellType
+        );
+    };
+
+    displayCell(impl->emptyCell);
+    displayCell(impl->departureCell);
+    displayCell(impl->arrivalCell);
+    displayCell(impl->starCell);
+    displayCell(impl->moreLifeCell);
+    displayCell(impl->lessLifeCell);
+    displayCell(impl->moreTimeCell);
+    displayCell(impl->lessTimeCell);
+    displayCell(impl->wallCell);
+    displayCell(impl->stairsUpCell);
+    displayCell(impl->stairsDownCell);
+    displayCell(impl->horizontalMirrorCell);
+    displayCell(impl->verticalMirrorCell);
+    displayCell(impl->leftRotationCell);
+    displayCell(impl->rightRotationCell);
+    displayCell(impl->elevatorUpCell);
+    displayCell(impl->elevatorDownCell);
+    displayCell(impl->diagonalCell);
 
     context.getSfmlWindow().draw(impl->selectedCellImage);
 }
@@ -242,8 +289,8 @@ void CellsSelector::selectMouseHoverCell() const &
 {
     const auto& selectedCellType = getMouseHoverCellType();
 
-    impl->selectedCellImage.setTexture(
-        impl->context.getCellsTexturesManager().getTextureReferenceByCellType(
+    impl->selectedCellImage.setTextureRect(
+        impl->context.getCellsTexturesManager().getAtlasTextureRectByCellType(
             selectedCellType
         )
     );
@@ -264,80 +311,17 @@ const char& CellsSelector::getSelectedCellType() const & noexcept
  */
 const char CellsSelector::getMouseHoverCellType() const &
 {
-    if (impl->emptyCell.isMouseHover())
-    {
-        return cells::EMPTY_CELL;
-    }
-    else if (impl->departureCell.isMouseHover())
-    {
-        return cells::DEPARTURE_CELL;
-    }
-    else if (impl->arrivalCell.isMouseHover())
-    {
-        return cells::ARRIVAL_CELL;
-    }
-    else if (impl->starCell.isMouseHover())
-    {
-        return cells::STAR_CELL;
-    }
-    else if (impl->moreLifeCell.isMouseHover())
-    {
-        return cells::MORE_LIFE_CELL;
-    }
-    else if (impl->lessLifeCell.isMouseHover())
-    {
-        return cells::LESS_LIFE_CELL;
-    }
-    else if (impl->moreTimeCell.isMouseHover())
-    {
-        return cells::MORE_TIME_CELL;
-    }
-    else if (impl->lessTimeCell.isMouseHover())
-    {
-        return cells::LESS_TIME_CELL;
-    }
-    else if (impl->wallCell.isMouseHover())
-    {
-        return cells::WALL_CELL;
-    }
-    else if (impl->stairsUpCell.isMouseHover())
-    {
-        return cells::STAIRS_UP_CELL;
-    }
-    else if (impl->stairsDownCell.isMouseHover())
-    {
-        return cells::STAIRS_DOWN_CELL;
-    }
-    else if (impl->horizontalMirrorCell.isMouseHover())
-    {
-        return cells::HORIZONTAL_MIRROR_CELL;
-    }
-    else if (impl->verticalMirrorCell.isMouseHover())
-    {
-        return cells::VERTICAL_MIRROR_CELL;
-    }
-    else if (impl->leftRotationCell.isMouseHover())
-    {
-        return cells::LEFT_ROTATION_CELL;
-    }
-    else if (impl->rightRotationCell.isMouseHover())
-    {
-        return cells::RIGHT_ROTATION_CELL;
-    }
-    else if (impl->elevatorUpCell.isMouseHover())
-    {
-        return cells::ELEVATOR_UP_CELL;
-    }
-    else if (impl->elevatorDownCell.isMouseHover())
-    {
-        return cells::ELEVATOR_DOWN_CELL;
-    }
-    else if (impl->diagonalCell.isMouseHover())
+    const short index = getGridCellIndex(
+        SELECTOR_GRID,
+        getCursorPosition()
+    );
+
+    if (index == NO_GRID_CELL)
     {
-        return cells::DIAGONAL_CELL;
+        return cells::NO_CELL;
     }
 
-    return cells::NO_CELL;
+    return SELECTOR_CELLS_TYPES[index];
 }
 
 }
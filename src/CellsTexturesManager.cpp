@@ -25,65 +25,162 @@
 #include "CellsTexturesManager.hpp"
 
 #include "cells.hpp"
+#include "ResourcesLoader.hpp"
 
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Image.hpp>
+
+#include <string>
+#include <vector>
 
 namespace memoris
 {
 namespace managers
 {
 
+/**
+ * @brief one cell picture to load into the atlas
+ */
+struct CellPicture
+{
+    char type;
+    const char* name;
+};
+
+/* the pictures are copied into the atlas in this order; the first one
+   is also used for every unknown cell type (empty cell) */
+constexpr CellPicture CELLS_PICTURES[] {
+    {cells::EMPTY_CELL, "empty"},
+    {cells::DEPARTURE_CELL, "departure"},
+    {cells::ARRIVAL_CELL, "arrival"},
+    {cells::STAR_CELL, "star"},
+    {cells::MORE_LIFE_CELL, "moreLife"},
+    {cells::LESS_LIFE_CELL, "lessLife"},
+    {cells::MORE_TIME_CELL, "moreTime"},
+    {cells::LESS_TIME_CELL, "lessTime"},
+    {cells::WALL_CELL, "wall"},
+    {cells::HIDDEN_CELL, "hidden"},
+    {cells::STAIRS_UP_CELL, "stairs_up"},
+    {cells::STAIRS_DOWN_CELL, "stairs_down"},
+    {cells::HORIZONTAL_MIRROR_CELL, "horizontal_mirror"},
+    {cells::VERTICAL_MIRROR_CELL, "vertical_mirror"},
+    {cells::DIAGONAL_CELL, "diagonal"},
+    {cells::LEFT_ROTATION_CELL, "rotate_left"},
+    {cells::RIGHT_ROTATION_CELL, "rotate_right"},
+    {cells::ELEVATOR_UP_CELL, "elevator_up"},
+    {cells::ELEVATOR_DOWN_CELL, "elevator_down"}
+};
+
+constexpr unsigned short CELLS_PICTURES_AMOUNT {
+    sizeof(CELLS_PICTURES) / sizeof(CellPicture)
+};
+
+/* every cell picture is 49 pixels wide and high; the pictures are separated
+   by one transparent pixel into the atlas, so the sampling of a rotated
+   floor never takes the pixels of the next picture */
+constexpr unsigned short CELL_PICTURE_DIMENSION {49};
+constexpr unsigned short ATLAS_SLOT_DIMENSION {50};
+constexpr unsigned short ATLAS_SLOTS_PER_LINE {5};
+constexpr unsigned short ATLAS_LINES {
+    (CELLS_PICTURES_AMOUNT + ATLAS_SLOTS_PER_LINE - 1) / ATLAS_SLOTS_PER_LINE
+};
+
+constexpr unsigned short CELL_TYPES_AMOUNT {256};
+
+/**
+ * @brief position of every cell picture into the atlas, indexed by the
+ * cell type character; the table is generated at compilation time, so
+ * getting the picture of a cell is only two arrays accesses (no branch)
+ */
+struct AtlasTable
+{
+    constexpr AtlasTable() :
+        horizontalPositions(),
+        verticalPositions()
+    {
+        for (
+            unsigned short slot {0};
+            slot < CELLS_PICTURES_AMOUNT;
+            slot += 1
+        )
+        {
+            const auto index =
+                static_cast<unsigned char>(CELLS_PICTURES[slot].type);
+
+            horizontalPositions[index] =
+                (slot % ATLAS_SLOTS_PER_LINE) * ATLAS_SLOT_DIMENSION;
+            verticalPositions[index] =
+                (slot / ATLAS_SLOTS_PER_LINE) * ATLAS_SLOT_DIMENSION;
+        }
+    }
+
+    unsigned short horizontalPositions[CELL_TYPES_AMOUNT];
+    unsigned short verticalPositions[CELL_TYPES_AMOUNT];
+};
+
+constexpr AtlasTable ATLAS_TABLE {};
+
+static_assert(
+    ATLAS_TABLE.horizontalPositions[
+        static_cast<unsigned char>(cells::NO_CELL)
+    ] == 0 and
+    ATLAS_TABLE.verticalPositions[
+        static_cast<unsigned char>(cells::NO_CELL)
+    ] == 0,
+    "unknown cell types must use the empty cell picture"
+);
+
 class CellsTexturesManager::Impl
 {
 
 public:
 
-    sf::Texture emptyCellTexture;
-    sf::Texture departureCellTexture;
-    sf::Texture arrivalCellTexture;
-    sf::Texture starCellTexture;
-    sf::Texture moreLifeCellTexture;
-    sf::Texture lessLifeCellTexture;
-    sf::Texture moreTimeCellTexture;
-    sf::Texture lessTimeCellTexture;
-    sf::Texture wallCellTexture;
-    sf::Texture hiddenCellTexture;
-    sf::Texture stairsUpCellTexture;
-    sf::Texture stairsDownCellTexture;
-    sf::Texture horizontalMirrorCellTexture;
-    sf::Texture verticalMirrorCellTexture;
-    sf::Texture diagonalCellTexture;
-    sf::Texture leftRotationCellTexture;
-    sf::Texture rightRotationCellTexture;
-    sf::Texture elevatorUpCellTexture;
-    sf::Texture elevatorDownCellTexture;
+    sf::Texture atlasTexture;
 };
 
 /**
  *
  */
-CellsTexturesManager::CellsTexturesManager() :
+CellsTexturesManager::CellsTexturesManager(
+    const utils::ResourcesLoader& loader
+) :
     impl(std::make_unique<Impl>())
 {
-    loadTexture(impl->emptyCellTexture, "empty");
-    loadTexture(impl->departureCellTexture, "departure");
-    loadTexture(impl->arrivalCellTexture, "arrival");
-    loadTexture(impl->starCellTexture, "star");
-    loadTexture(impl->moreLifeCellTexture, "moreLife");
-    loadTexture(impl->lessLifeCellTexture, "lessLife");
-    loadTexture(impl->moreTimeCellTexture, "moreTime");
-    loadTexture(impl->lessTimeCellTexture, "lessTime");
-    loadTexture(impl->wallCellTexture, "wall");
-    loadTexture(impl->hiddenCellTexture, "hidden");
-    loadTexture(impl->stairsUpCellTexture, "stairs_up");
-    loadTexture(impl->stairsDownCellTexture, "stairs_down");
-    loadTexture(impl->horizontalMirrorCellTexture, "horizontal_mirror");
-    loadTexture(impl->verticalMirrorCellTexture, "vertical_mirror");
-    loadTexture(impl->diagonalCellTexture, "diagonal");
-    loadTexture(impl->leftRotationCellTexture, "rotate_left");
-    loadTexture(impl->rightRotationCellTexture, "rotate_right");
-    loadTexture(impl->elevatorUpCellTexture, "elevator_up");
-    loadTexture(impl->elevatorDownCellTexture, "elevator_down");
+    sf::Image atlas;
+    atlas.create(
+        ATLAS_SLOTS_PER_LINE * ATLAS_SLOT_DIMENSION,
+        ATLAS_LINES * ATLAS_SLOT_DIMENSION,
+        sf::Color::Transparent
+    );
+
+    /* the atlas is used by every level and by the menus background,
+       all the pictures are decoded together when the game starts */
+    std::vector<std::string> names;
+
+    for (const auto& picture : CELLS_PICTURES)
+    {
+        names.push_back(std::string("cells/") + picture.name + ".png");
+    }
+
+    const auto pictures = loader.decodePictures(names);
+
+    for (
+        unsigned short slot {0};
+        slot < CELLS_PICTURES_AMOUNT;
+        slot += 1
+    )
+    {
+        copyPicture(
+            atlas,
+            pictures[slot],
+            CELLS_PICTURES[slot].type
+        );
+    }
+
+    if (!impl->atlasTexture.loadFromImage(atlas))
+    {
+        throw std::invalid_argument("Cannot create the cells atlas texture");
+    }
 }
 
 /**
@@ -94,101 +191,44 @@ CellsTexturesManager::~CellsTexturesManager() = default;
 /**
  *
  */
-const sf::Texture& CellsTexturesManager::getTextureReferenceByCellType(
+const sf::Texture& CellsTexturesManager::getAtlasTexture() const & noexcept
+{
+    return impl->atlasTexture;
+}
+
+/**
+ *
+ */
+const sf::IntRect CellsTexturesManager::getAtlasTextureRectByCellType(
     const char& type
 ) const & noexcept
 {
-    switch(type)
-    {
-    case cells::WALL_CELL:
-    {
-        return impl->wallCellTexture;
-    }
-    case cells::DEPARTURE_CELL:
-    {
-        return impl->departureCellTexture;
-    }
-    case cells::ARRIVAL_CELL:
-    {
-        return impl->arrivalCellTexture;
-    }
-    case cells::STAR_CELL:
-    {
-        return impl->starCellTexture;
-    }
-    case cells::MORE_LIFE_CELL:
-    {
-        return impl->moreLifeCellTexture;
-    }
-    case cells::LESS_LIFE_CELL:
-    {
-        return impl->lessLifeCellTexture;
-    }
-    case cells::MORE_TIME_CELL:
-    {
-        return impl->moreTimeCellTexture;
-    }
-    case cells::LESS_TIME_CELL:
-    {
-        return impl->lessTimeCellTexture;
-    }
-    case cells::STAIRS_UP_CELL:
-    {
-        return impl->stairsUpCellTexture;
-    }
-    case cells::STAIRS_DOWN_CELL:
-    {
-        return impl->stairsDownCellTexture;
-    }
-    case cells::HORIZONTAL_MIRROR_CELL:
-    {
-        return impl->horizontalMirrorCellTexture;
-    }
-    case cells::VERTICAL_MIRROR_CELL:
-    {
-        return impl->verticalMirrorCellTexture;
-    }
-    case cells::DIAGONAL_CELL:
-    {
-        return impl->diagonalCellTexture;
-    }
-    case cells::LEFT_ROTATION_CELL:
-    {
-        return impl->leftRotationCellTexture;
-    }
-    case cells::RIGHT_ROTATION_CELL:
-    {
-        return impl->rightRotationCellTexture;
-    }
-    case cells::HIDDEN_CELL:
-    {
-        return impl->hiddenCellTexture;
-    }
-    case cells::ELEVATOR_UP_CELL:
-    {
-        return impl->elevatorUpCellTexture;
-    }
-    case cells::ELEVATOR_DOWN_CELL:
-    {
-        return impl->elevatorDownCellTexture;
-    }
-    }
+    const auto index = static_cast<unsigned char>(type);
 
-    return impl->emptyCellTexture;
+    return sf::IntRect(
+        ATLAS_TABLE.horizontalPositions[index],
+        ATLAS_TABLE.verticalPositions[index],
+        CELL_PICTURE_DIMENSION,
+        CELL_PICTURE_DIMENSION
+    );
 }
 
 /**
  *
  */
-void CellsTexturesManager::loadTexture(
-    sf::Texture& texture,
-    const std::string& path
+void CellsTexturesManager::copyPicture(
+    sf::Image& atlas,
+    const sf::Image& picture,
+    const char& type
 ) &
 {
-    if (!texture.loadFromFile("res/cells/" + path + ".png"))
-    {
-        throw std::invalid_argument("Cannot load texture : " + path);
-    }
+    const auto index = static_cast<unsigned char>(type);
+
+    atlas.copy(
+        picture,
+        ATLAS_TABLE.horizontalPositions[index],
+        ATLAS_TABLE.verticalPositions[index]
+    );
 }
 
 }
@@ -0,0 +1,410 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ContentCatalog.cpp
+ * @package managers
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "ContentCatalog.hpp"
+
+#include "level_files.hpp"
+
+#include <array>
+#include <fstream>
+#include <stdexcept>
+
+#include <dirent.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace memoris
+{
+namespace managers
+{
+
+constexpr std::size_t DIRECTORIES_AMOUNT {5};
+
+/* in the order of the ContentDirectory enumeration */
+constexpr const char* DIRECTORIES_PATHS[DIRECTORIES_AMOUNT] {
+    "data/levels/officials/",
+    "data/levels/personals/",
+    "data/series/officials/",
+    "data/series/personals/",
+    "data/games/"
+};
+
+constexpr const char* DIRECTORIES_EXTENSIONS[DIRECTORIES_AMOUNT] {
+    levels::TEXT_LEVEL_EXTENSION,
+    levels::TEXT_LEVEL_EXTENSION,
+    ".serie",
+    ".serie",
+    ".game"
+};
+
+constexpr int NO_DESCRIPTOR {-1};
+
+/* the events of a file that has been written, created or removed; the
+   file is indexed again when it is closed after writing, not on every
+   single write */
+constexpr std::uint32_t WATCHED_EVENTS {
+    IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM
+};
+
+class ContentCatalog::Impl
+{
+
+public:
+
+    Impl()
+    {
+        notifications = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+        for (
+            std::size_t index {0};
+            index < DIRECTORIES_AMOUNT;
+            index += 1
+        )
+        {
+            watches[index] = notifications == NO_DESCRIPTOR ?
+                NO_DESCRIPTOR :
+                inotify_add_watch(
+                    notifications,
+                    DIRECTORIES_PATHS[index],
+                    WATCHED_EVENTS
+                );
+
+            scanDirectory(index);
+        }
+    }
+
+    ~Impl()
+    {
+        /* the watches are removed with the notifications descriptor */
+        if (notifications != NO_DESCRIPTOR)
+        {
+            close(notifications);
+        }
+    }
+
+    /**
+     * @brief indexes all the files of the given directory, replacing
+     * the previous entries
+     *
+     * @param index the index of the directory
+     */
+    void scanDirectory(const std::size_t& index) &
+    {
+        auto& directoryEntries = entries[index];
+        directoryEntries.clear();
+
+        DIR* directory = opendir(DIRECTORIES_PATHS[index]);
+
+        if (directory == NULL)
+        {
+            return;
+        }
+
+        struct dirent* reader = NULL;
+        std::string name;
+
+        while ((reader = readdir(directory)) != NULL)
+        {
+            if (getContentName(index, reader->d_name, name))
+            {
+                indexFile(index, name);
+            }
+        }
+
+        closedir(directory);
+    }
+
+    /**
+     * @brief reads the metadata of the given file and updates its entry;
+     * the entry is removed if the file cannot be read anymore
+     *
+     * @param index the index of the directory of the file
+     * @param name the file name without extension
+     */
+    void indexFile(
+        const std::size_t& index,
+        const std::string& name
+    ) &
+    {
+        const std::string path = DIRECTORIES_PATHS[index] + name;
+        const std::string filePath = path + DIRECTORIES_EXTENSIONS[index];
+
+        struct stat status;
+
+        if (stat(filePath.c_str(), &status) != 0)
+        {
+            entries[index].erase(name);
+
+            return;
+        }
+
+        ContentEntry entry;
+        entry.size = status.st_size;
+        entry.modificationTime = status.st_mtime;
+
+        const auto directory = static_cast<ContentDirectory>(index);
+
+        if (
+            directory == ContentDirectory::OfficialLevels or
+            directory == ContentDirectory::PersonalLevels
+        )
+        {
+            /* an invalid level is still listed, as before the catalog,
+               the error is displayed when it is opened */
+            try
+            {
+                const auto level = levels::loadLevelFile(path);
+
+                entry.starsAmount = level.starsAmount;
+                entry.floorsAmount = level.lastPlayableFloor + 1;
+            }
+            catch (std::invalid_argument&)
+            {
+            }
+        }
+        else if (directory == ContentDirectory::Games)
+        {
+            /* the game file only contains the last unlocked serie */
+            std::ifstream file(filePath);
+
+            char serieCharacter {'0'};
+            file.get(serieCharacter);
+
+            if (serieCharacter >= '0' and serieCharacter <= '9')
+            {
+                entry.lastUnlockedSerie = serieCharacter - '0';
+            }
+        }
+
+        entries[index][name] = entry;
+    }
+
+    /**
+     * @brief applies the files changes notified since the previous call;
+     * the directories that cannot be watched are scanned again entirely
+     */
+    void refresh() &
+    {
+        for (
+            std::size_t index {0};
+            index < DIRECTORIES_AMOUNT;
+            index += 1
+        )
+        {
+            if (watches[index] == NO_DESCRIPTOR)
+            {
+                scanDirectory(index);
+            }
+        }
+
+        if (notifications == NO_DESCRIPTOR)
+        {
+            return;
+        }
+
+        alignas(struct inotify_event) char buffer[4096];
+        std::string name;
+
+        /* non blocking descriptor, the loop stops when there is
+           no more event to read */
+        ssize_t length;
+        while ((length = read(notifications, buffer, sizeof(buffer))) > 0)
+        {
+            for (
+                const char* position = buffer;
+                position < buffer + length;
+                position += sizeof(struct inotify_event) +
+                    reinterpret_cast<const struct inotify_event*>(
+                        position
+                    )->len
+            )
+            {
+                const auto event =
+                    reinterpret_cast<const struct inotify_event*>(position);
+
+                if (event->mask & IN_Q_OVERFLOW)
+                {
+                    rescanWatchedDirectories();
+
+                    continue;
+                }
+
+                const auto index = getDirectoryIndex(event->wd);
+
+                if (
+                    event->len == 0 or
+                    index == DIRECTORIES_AMOUNT or
+                    not getContentName(index, event->name, name)
+                )
+                {
+                    continue;
+                }
+
+                if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+                {
+                    entries[index].erase(name);
+                }
+                else
+                {
+                    indexFile(index, name);
+                }
+            }
+        }
+    }
+
+    std::array<ContentEntries, DIRECTORIES_AMOUNT> entries;
+
+private:
+
+    /**
+     * @brief gets the content name of the given file name of the given
+     * directory, so the file name without extension; returns false if
+     * the file does not have the extension of the directory
+     *
+     * @param index the index of the directory
+     * @param fileName the file name
+     * @param name the content name to update
+     *
+     * @return const bool
+     */
+    const bool getContentName(
+        const std::size_t& index,
+        const std::string& fileName,
+        std::string& name
+    ) const &
+    {
+        const std::string extension = DIRECTORIES_EXTENSIONS[index];
+
+        if (
+            fileName.size() <= extension.size() or
+            fileName.compare(
+                fileName.size() - extension.size(),
+                extension.size(),
+                extension
+            ) != 0
+        )
+        {
+            return false;
+        }
+
+        name.assign(
+            fileName,
+            0,
+            fileName.size() - extension.size()
+        );
+
+        return true;
+    }
+
+    /**
+     * @brief returns the index of the directory with the given watch
+     * descriptor, DIRECTORIES_AMOUNT if there is no one
+     *
+     * @param watch the watch descriptor
+     *
+     * @return const std::size_t
+     */
+    const std::size_t getDirectoryIndex(const int& watch) const & noexcept
+    {
+        std::size_t index {0};
+
+        while (index < DIRECTORIES_AMOUNT and watches[index] != watch)
+        {
+            index += 1;
+        }
+
+        return index;
+    }
+
+    /**
+     * @brief scans again all the watched directories, when some
+     * notifications have been lost
+     */
+    void rescanWatchedDirectories() &
+    {
+        for (
+            std::size_t index {0};
+            index < DIRECTORIES_AMOUNT;
+            index += 1
+        )
+        {
+            if (watches[index] != NO_DESCRIPTOR)
+            {
+                scanDirectory(index);
+            }
+        }
+    }
+
+    std::array<int, DIRECTORIES_AMOUNT> watches;
+
+    int notifications {NO_DESCRIPTOR};
+};
+
+/**
+ *
+ */
+ContentCatalog::ContentCatalog() :
+    impl(std::make_unique<Impl>())
+{
+}
+
+/**
+ *
+ */
+ContentCatalog::~ContentCatalog() = default;
+
+/**
+ *
+ */
+const ContentEntries& ContentCatalog::getEntries(
+    const ContentDirectory& directory
+) const &
+{
+    impl->refresh();
+
+    return impl->entries[static_cast<std::size_t>(directory)];
+}
+
+/**
+ *
+ */
+const ContentEntry* ContentCatalog::getEntry(
+    const ContentDirectory& directory,
+    const std::string& name
+) const &
+{
+    const auto& entries = getEntries(directory);
+    const auto entry = entries.find(name);
+
+    if (entry == entries.cend())
+    {
+        return nullptr;
+    }
+
+    return &entry->second;
+}
+
+}
+}
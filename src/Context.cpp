@@ -24,6 +24,7 @@
 
 #include "Context.hpp"
 
+#include "ResourcesLoader.hpp"
 #include "TexturesManager.hpp"
 #include "SoundsManager.hpp"
 #include "ColorsManager.hpp"
@@ -32,57 +33,116 @@
 #include "ShapesManager.hpp"
 #include "PlayingSerieManager.hpp"
 #include "EditingLevelManager.hpp"
+#include "ContentCatalog.hpp"
+#include "FrameProfiler.hpp"
+#include "ProfiledWindow.hpp"
 #include "window.hpp"
 #include "controllers_ids.hpp"
-
-#include <SFML/Graphics/RenderWindow.hpp>
-#include <SFML/Audio/Music.hpp>
-#include <SFML/Audio/Sound.hpp>
+#include "MusicStreamer.hpp"
 
 namespace memoris
 {
 namespace utils
 {
 
+/**
+ * @brief returns the file path of the given music
+ *
+ * @param id the music id
+ *
+ * @return std::string
+ */
+std::string getMusicFilePath(const Context::MusicId& id)
+{
+    std::string path;
+
+    switch(id)
+    {
+    case Context::MusicId::FirstGameMusic:
+    {
+        path = "Zeropage_-_Ambiose";
+
+        break;
+    }
+    case Context::MusicId::SecondGameMusic:
+    {
+        path = "Zeropage_-_Void_Sensor";
+
+        break;
+    }
+    default:
+    {
+        path = "Zeropage_-_Ambient_Dance";
+    }
+    }
+
+    constexpr char MUSICS_PATH[] {"res/musics/"};
+    constexpr char MUSICS_EXTENSION[] {".ogg"};
+
+    return MUSICS_PATH + path + MUSICS_EXTENSION;
+}
+
 class Context::Impl
 {
 
 public:
 
-    managers::TexturesManager texturesManager;
-    managers::SoundsManager soundsManager;
+    Impl(const sf::Uint32& windowStyle) :
+        sfmlWindow(
+            frameProfiler,
+
+            /* the float width is only converted once
+               when creating the window and no conversion
+               is necessary when calculating the horizontal
+               position of centered text */
+            sf::VideoMode(
+                static_cast<unsigned int>(window::WIDTH),
+                window::HEIGHT
+            ),
+            "Memoris",
+            windowStyle
+        )
+    {
+    }
+
+    /* declared before the managers, the fonts are read from the pack
+       mapped by the loader */
+    ResourcesLoader resourcesLoader;
+
+    managers::TexturesManager texturesManager {resourcesLoader};
+    managers::SoundsManager soundsManager {resourcesLoader};
     managers::ColorsManager colorsManager;
-    managers::FontsManager fontsManager;
-    managers::CellsTexturesManager cellsTexturesManager;
+    managers::FontsManager fontsManager {resourcesLoader};
+    managers::CellsTexturesManager cellsTexturesManager {resourcesLoader};
     managers::ShapesManager shapesManager;
     managers::PlayingSerieManager playingSerieManager;
     managers::EditingLevelManager editingLevelManager;
+    managers::ContentCatalog contentCatalog;
 
-    sf::RenderWindow sfmlWindow =
-    {
-        /* the float width is only converted once
-           when creating the window and no conversion
-           is necessary when calculating the horizontal
-           position of centered text */
-        sf::VideoMode(
-            static_cast<unsigned int>(window::WIDTH),
-            window::HEIGHT
-        ),
-        "Memoris",
-        sf::Style::Fullscreen
-    };
-
-    sf::Music music;
+    /* declared before the window, the window reports to the profiler */
+    FrameProfiler frameProfiler;
+
+    ProfiledWindow sfmlWindow;
+
+    sounds::MusicStreamer music;
 
     sf::Clock clock;
 
     std::string gameName;
+    std::string replayFilePath;
 };
 
 /**
  *
  */
-Context::Context() : impl(std::make_unique<Impl>())
+Context::Context(const WindowMode& windowMode) :
+    impl(
+        std::make_unique<Impl>(
+            windowMode == WindowMode::Fullscreen ?
+                sf::Style::Fullscreen :
+                sf::Style::None
+        )
+    )
 {
     auto& window = impl->sfmlWindow;
     window.setMouseCursorVisible(false);
@@ -91,9 +151,17 @@ Context::Context() : impl(std::make_unique<Impl>())
        triggered one time during the first press down and not continuously */
     window.setKeyRepeatEnabled(false);
 
-    /* prevent intensive CPU usage */
-    constexpr unsigned int FPS_LIMIT {60};
-    window.setFramerateLimit(FPS_LIMIT);
+    if (windowMode == WindowMode::Hidden)
+    {
+        /* the frames of a hidden window are paced by the tool using it,
+           display() must not wait for the screen */
+        window.setVisible(false);
+        window.setVerticalSyncEnabled(false);
+
+        return;
+    }
+
+    window.setFramerateLimit(window::FPS_LIMIT);
 }
 
 /**
@@ -171,11 +239,28 @@ noexcept
 /**
  *
  */
-sf::RenderWindow& Context::getSfmlWindow() const & noexcept
+const managers::ContentCatalog& Context::getContentCatalog() const &
+noexcept
+{
+    return impl->contentCatalog;
+}
+
+/**
+ *
+ */
+ProfiledWindow& Context::getSfmlWindow() const & noexcept
 {
     return impl->sfmlWindow;
 }
 
+/**
+ *
+ */
+const FrameProfiler& Context::getFrameProfiler() const & noexcept
+{
+    return impl->frameProfiler;
+}
+
 /**
  *
  */
@@ -209,41 +294,17 @@ const Context::MusicId Context::getMusicId(const controllers::ControllerId& id)
 /**
  *
  */
-void Context::loadMusicFile(const MusicId& id) const &
+void Context::prefetchMusic(const MusicId& id) const &
 {
-    std::string path;
-
-    switch(id)
-    {
-    case Context::MusicId::FirstGameMusic:
-    {
-        path = "Zeropage_-_Ambiose";
-
-        break;
-    }
-    case Context::MusicId::SecondGameMusic:
-    {
-        path = "Zeropage_-_Void_Sensor";
-
-        break;
-    }
-    default:
-    {
-        path = "Zeropage_-_Ambient_Dance";
-    }
-    }
-
-    stopMusic();
-
-    auto& music = impl->music;
+    impl->music.prefetch(getMusicFilePath(id));
+}
 
-    constexpr char MUSICS_PATH[] {"res/musics/"};
-    constexpr char MUSICS_EXTENSION[] {".ogg"};
-    if(music.openFromFile(MUSICS_PATH + path + MUSICS_EXTENSION))
-    {
-        music.play();
-        music.setLoop(true);
-    }
+/**
+ *
+ */
+void Context::playMusic(const MusicId& id) const &
+{
+    impl->music.play(getMusicFilePath(id));
 }
 
 /**
@@ -251,11 +312,7 @@ void Context::loadMusicFile(const MusicId& id) const &
  */
 void Context::stopMusic() const &
 {
-    auto& music = impl->music;
-    if(music.getStatus() == sf::Sound::Playing)
-    {
-        music.stop();
-    }
+    impl->music.stop();
 }
 
 /**
@@ -282,5 +339,21 @@ const std::string& Context::getGameName() const & noexcept
     return impl->gameName;
 }
 
+/**
+ *
+ */
+void Context::setReplayFilePath(const std::string& path) const & noexcept
+{
+    impl->replayFilePath = path;
+}
+
+/**
+ *
+ */
+const std::string& Context::getReplayFilePath() const & noexcept
+{
+    return impl->replayFilePath;
+}
+
 }
 }
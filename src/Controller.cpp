@@ -28,17 +28,23 @@
 #include "window.hpp"
 #include "ColorsManager.hpp"
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
+#include "FixedTimestep.hpp"
 
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Window/Event.hpp>
 
+#include <algorithm>
+
 namespace memoris
 {
 
 namespace controllers
 {
 
+constexpr sf::Int32 TRANSITION_ANIMATION_INTERVAL {25};
+constexpr sf::Uint8 CLOSED_SCREEN_TRANSITION_STEP {5};
+
 class Controller::Impl
 {
 
@@ -60,9 +66,9 @@ public:
         transitionSurface.setFillColor(transitionSurfaceColor);
     }
 
-    sf::Int32 lastScreenTransitionTime {0};
+    utils::FixedTimestep transitionSteps {TRANSITION_ANIMATION_INTERVAL};
 
-    sf::Uint8 transitionStep {5};
+    sf::Uint8 transitionStep {CLOSED_SCREEN_TRANSITION_STEP};
 
     sf::Color transitionSurfaceColor;
 
@@ -92,6 +98,34 @@ Controller::Controller(const utils::Context& context) :
  */
 Controller::~Controller() = default;
 
+/**
+ *
+ */
+void Controller::reset() const &
+{
+    impl->nextControllerId = ControllerId::NoController;
+    impl->expectedControllerId = ControllerId::NoController;
+    impl->openingScreen = true;
+    impl->transitionStep = CLOSED_SCREEN_TRANSITION_STEP;
+    impl->transitionSteps.restart(impl->context.getClockMillisecondsTime());
+}
+
+/**
+ *
+ */
+const ControllerId& Controller::getExpectedControllerId() const & noexcept
+{
+    return impl->expectedControllerId;
+}
+
+/**
+ *
+ */
+const bool Controller::isRedrawTracked() const & noexcept
+{
+    return false;
+}
+
 /**
  *
  */
@@ -100,51 +134,85 @@ const ControllerId Controller::animateScreenTransition(
 ) const &
 {
     const auto& expectedControllerId = impl->expectedControllerId;
+    const auto& currentTime = context.getClockMillisecondsTime();
+    auto& transitionSteps = impl->transitionSteps;
 
     if (
         expectedControllerId == ControllerId::NoController and 
         not impl->openingScreen
     )
     {
+        /* the closing transition starts from the frame it is requested */
+        transitionSteps.restart(currentTime);
+
         return ControllerId::NoController;
     }
 
-    auto& transitionSurfaceColor = impl->transitionSurfaceColor;
-    auto& transitionSurface = impl->transitionSurface;
-
-    constexpr sf::Uint8 COLOR_UPDATE_STEP {51};
-    transitionSurfaceColor.a = impl->transitionStep * COLOR_UPDATE_STEP;
-    transitionSurface.setFillColor(transitionSurfaceColor);
-
     auto& window = context.getSfmlWindow();
-    window.draw(transitionSurface);
+    window.invalidate();
 
-    const auto& currentTime = context.getClockMillisecondsTime();
-    auto& lastTime = impl->lastScreenTransitionTime;
     auto& transitionStep = impl->transitionStep;
 
-    constexpr sf::Int32 TRANSITION_ANIMATION_INTERVAL {25};
-    if (currentTime - lastTime > TRANSITION_ANIMATION_INTERVAL)
+    constexpr sf::Uint8 TRANSITION_STEPS_MAX {CLOSED_SCREEN_TRANSITION_STEP};
+    constexpr unsigned short OPENED_SCREEN_MINIMUM_STEP {0};
+
+    /* every elapsed step is applied, so the transition duration does not
+       depend on the frame rate; the step never goes beyond its bounds */
+    for (
+        auto steps = transitionSteps.consumeSteps(currentTime);
+        steps != 0;
+        steps -= 1
+    )
     {
         if (impl->openingScreen)
         {
+            if (transitionStep <= OPENED_SCREEN_MINIMUM_STEP)
+            {
+                break;
+            }
+
             transitionStep -= 1;
         }
         else
         {
+            if (transitionStep > TRANSITION_STEPS_MAX)
+            {
+                break;
+            }
+
             transitionStep += 1;
         }
-
-        lastTime = currentTime;
     }
 
-    constexpr sf::Uint8 TRANSITION_STEPS_MAX {5};
+    /* the surface is rendered between the current step and the next one */
+    const auto interpolation = transitionSteps.getInterpolation(currentTime);
+    const float renderedStep = impl->openingScreen ?
+        transitionStep - interpolation :
+        transitionStep + interpolation;
+
+    constexpr float COLOR_UPDATE_STEP {51.f};
+    constexpr float OPAQUE_ALPHA {255.f};
+    auto& transitionSurfaceColor = impl->transitionSurfaceColor;
+    transitionSurfaceColor.a = static_cast<sf::Uint8>(
+        std::min(
+            std::max(
+                renderedStep * COLOR_UPDATE_STEP,
+                0.f
+            ),
+            OPAQUE_ALPHA
+        )
+    );
+
+    auto& transitionSurface = impl->transitionSurface;
+    transitionSurface.setFillColor(transitionSurfaceColor);
+
+    window.draw(transitionSurface);
+
     if (transitionStep > TRANSITION_STEPS_MAX)
     {
         return expectedControllerId;
     }
 
-    constexpr unsigned short OPENED_SCREEN_MINIMUM_STEP {0};
     if (transitionStep <= OPENED_SCREEN_MINIMUM_STEP)
     {
         impl->openingScreen = false;
@@ -0,0 +1,163 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ControllerPool.cpp
+ * @package controllers
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "ControllerPool.hpp"
+
+#include "Controller.hpp"
+#include "controllers.hpp"
+#include "controllers_ids.hpp"
+#include "Context.hpp"
+#include "TexturesManager.hpp"
+#include "SoundsManager.hpp"
+
+#include <map>
+
+namespace memoris
+{
+namespace controllers
+{
+
+namespace
+{
+
+/**
+ * @brief true if the controller of the given id only depends on its
+ * creation and on the resources, so it can be displayed again without
+ * being created again; the other menus read the game files or update
+ * the serie manager when they are created
+ *
+ * @param id the controller id
+ *
+ * @return const bool
+ */
+const bool isPooledController(const ControllerId& id) noexcept
+{
+    return id == ControllerId::MainMenu or id == ControllerId::EditorMenu;
+}
+
+}
+
+class ControllerPool::Impl
+{
+
+public:
+
+    Impl(const utils::Context& context) :
+        context(context)
+    {
+    }
+
+    const utils::Context& context;
+
+    std::map<ControllerId, std::unique_ptr<Controller>> pooledControllers;
+
+    /* the last created controller that is not pooled; kept until the
+       next controller is returned */
+    std::unique_ptr<Controller> createdController {nullptr};
+};
+
+/**
+ *
+ */
+ControllerPool::ControllerPool(const utils::Context& context) :
+    impl(std::make_unique<Impl>(context))
+{
+}
+
+/**
+ *
+ */
+ControllerPool::~ControllerPool() = default;
+
+/**
+ *
+ */
+const Controller& ControllerPool::getController(
+    const ControllerId& id,
+    const ControllerId& previousControllerId
+) &
+{
+    /* the previous controller is destroyed before the creation,
+       they are never both in memory and its textures and sounds can be
+       released */
+    auto& createdController = impl->createdController;
+    createdController.reset();
+
+    impl->context.getTexturesManager().preloadControllerTextures(id);
+    impl->context.getSoundsManager().preloadControllerSounds(id);
+
+    if (not isPooledController(id))
+    {
+        createdController = getControllerById(
+            impl->context,
+            id,
+            previousControllerId
+        );
+
+        return *createdController;
+    }
+
+    auto& controller = impl->pooledControllers[id];
+
+    if (controller == nullptr)
+    {
+        controller = getControllerById(
+            impl->context,
+            id,
+            previousControllerId
+        );
+
+        return *controller;
+    }
+
+    controller->reset();
+
+    return *controller;
+}
+
+/**
+ *
+ */
+void ControllerPool::prepareController(const ControllerId& id) &
+{
+    if (not isPooledController(id))
+    {
+        return;
+    }
+
+    auto& controller = impl->pooledControllers[id];
+
+    if (controller != nullptr)
+    {
+        return;
+    }
+
+    controller = getControllerById(
+        impl->context,
+        id,
+        id
+    );
+}
+
+}
+}
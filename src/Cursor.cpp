@@ -26,10 +26,10 @@
 
 #include "TexturesManager.hpp"
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
 
 #include <SFML/Window/Mouse.hpp>
 #include <SFML/Graphics/Sprite.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
 
 namespace memoris
 {
@@ -42,11 +42,14 @@ class Cursor::Impl
 public:
 
     Impl(const utils::Context& context) :
+        texture(context.getTexturesManager().getCursorTexture()),
         context(context)
     {
-        sprite.setTexture(context.getTexturesManager().getCursorTexture());
+        sprite.setTexture(*texture);
     }
 
+    managers::TextureHandle texture;
+
     sf::Sprite sprite;
 
     sf::Uint32 lastUpdateTime {0};
@@ -97,7 +100,17 @@ void Cursor::render() const &
         static_cast<float>(positionIntegers.y)
     );
 
-    impl->sprite.setPosition(positionFloats);
+    /* the mouse position is sampled a few milliseconds after the last
+       mouse event, so the cursor invalidates the window by itself */
+    if (
+        positionFloats.x != impl->sprite.getPosition().x or
+        positionFloats.y != impl->sprite.getPosition().y
+    )
+    {
+        impl->sprite.setPosition(positionFloats);
+
+        context.getSfmlWindow().invalidate();
+    }
 
     lastUpdateTime = currentTime;
 }
@@ -27,12 +27,12 @@
 #include "SoundsManager.hpp"
 #include "ColorsManager.hpp"
 #include "ShapesManager.hpp"
-#include "Cell.hpp"
 #include "Level.hpp"
 #include "Context.hpp"
+#include "floor_permutations.hpp"
+#include "ProfiledWindow.hpp"
 
 #include <SFML/Graphics/RectangleShape.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
 
 namespace memoris
 {
@@ -40,6 +40,7 @@ namespace animations
 {
 
 constexpr unsigned short FLOORS_PER_LEVEL {10};
+constexpr sf::Int32 ANIMATION_STEPS_INTERVAL {100};
 
 class DiagonalAnimation::Impl
 {
@@ -61,7 +62,9 @@ DiagonalAnimation::DiagonalAnimation(
     LevelAnimation(
         context,
         level,
-        floor
+        floor,
+        ANIMATION_STEPS_INTERVAL,
+        FirstStep::Immediate
     )
 {
 }
@@ -76,22 +79,18 @@ DiagonalAnimation::~DiagonalAnimation() = default;
  */
 void DiagonalAnimation::renderAnimation() &
 {
-    constexpr sf::Uint32 ANIMATION_INTERVAL {100};
-    if (
-        getContext().getClockMillisecondsTime() - 
-        getAnimationLastUpdateTime() < ANIMATION_INTERVAL
+    for (
+        auto steps = getElapsedAnimationSteps();
+        steps != 0 and not isFinished();
+        steps -= 1
     )
     {
-        displayLevelAndSeparator();
+        playNextAnimationStep();
 
-        return;
+        incrementAnimationStep();
     }
 
-    playNextAnimationStep();
-
     displayLevelAndSeparator();
-
-    incrementAnimationStep();
 }
 
 /**
@@ -125,13 +124,13 @@ void DiagonalAnimation::playNextAnimationStep() const &
     {
     case 3:
     {
-        invertTopLeftWithBottomRight();
+        swapQuarters(game::QuartersSwap::TopLeftWithBottomRight);
 
         break;
     }
     case 9:
     {
-        invertBottomLeftWithTopRight();
+        swapQuarters(game::QuartersSwap::TopRightWithBottomLeft);
 
         break;
     }
@@ -207,7 +206,10 @@ void DiagonalAnimation::applyPurpleColorOnCellsQuarters(const sf::Color& color)
             )
         )
         {
-            getLevel()->getCells()[index]->setCellColor(color);
+            getLevel()->setCellColor(
+                index,
+                color
+            );
         }
     }
 }
@@ -215,104 +217,20 @@ void DiagonalAnimation::applyPurpleColorOnCellsQuarters(const sf::Color& color)
 /**
  *
  */
-void DiagonalAnimation::invertTopLeftWithBottomRight() const &
+void DiagonalAnimation::swapQuarters(const game::QuartersSwap& swap) const &
 {
+    const auto& permutation = game::getFloorPermutation(swap);
 
-    for(
-        unsigned short floor = 0;
+    for (
+        unsigned short floor {0};
         floor < FLOORS_PER_LEVEL;
         floor += 1
     )
     {
-
-        unsigned short index = floor * 256;
-
-        while(index != floor * 256 + 128)
-        {
-            if (
-                index < floor * 256 + 128 &&
-                ((index - floor * 256) % 16) < 8
-            )
-            {
-                invertCells(
-                    index,
-                    136
-                );
-            }
-
-            index += 1;
-        }
-    }
-}
-
-/**
- *
- */
-void DiagonalAnimation::invertBottomLeftWithTopRight() const &
-{
-    for(
-        unsigned short floor = 0;
-        floor < FLOORS_PER_LEVEL;
-        floor += 1
-    )
-    {
-
-        unsigned short index = floor * 256 + 128;
-
-        while(index < (floor + 1) * 256)
-        {
-            if (
-                index >= floor * 256 + 128 &&
-                ((index - floor * 256) % 16) < 8
-            )
-            {
-                invertCells(
-                    index,
-                    -120
-                );
-            }
-
-            index += 1;
-        }
-    }
-}
-
-/**
- *
- */
-void DiagonalAnimation::invertCells(
-    const unsigned short& source,
-    const short& difference
-) const &
-{
-    const auto& level = getLevel();
-
-    char type = level->getCells()[source + difference]->getType();
-    bool visible = level->getCells()[source + difference]->isVisible();
-
-    level->getCells()[source + difference]->setType(
-        level->getCells()[source]->getType()
-    );
-
-    level->getCells()[source]->setType(type);
-
-    showOrHideCell(
-        source + difference,
-        level->getCells()[source]->isVisible()
-    );
-
-    showOrHideCell(
-        source,
-        visible
-    );
-
-    if (source == level->getPlayerCellIndex())
-    {
-        setUpdatedPlayerIndex(source + difference);
-    }
-    else if (source + difference == level->getPlayerCellIndex())
-    {
-        setUpdatedPlayerIndex(source);
+        permuteFloorCells(
+            floor,
+            permutation
+        );
     }
 }
 
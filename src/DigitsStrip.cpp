@@ -0,0 +1,216 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file DigitsStrip.cpp
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "DigitsStrip.hpp"
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <array>
+#include <algorithm>
+
+namespace memoris
+{
+namespace utils
+{
+
+/* the digits followed by the colon, in the order of the strip */
+constexpr char STRIP_CHARACTERS[] {"0123456789:"};
+constexpr std::size_t STRIP_CHARACTERS_AMOUNT {sizeof(STRIP_CHARACTERS) - 1};
+constexpr std::size_t COLON_INDEX {STRIP_CHARACTERS_AMOUNT - 1};
+
+/* transparent pixels between two glyphs, so the smoothed texture
+   does not blend two neighbour glyphs */
+constexpr int GLYPHS_PADDING {2};
+
+class DigitsStrip::Impl
+{
+
+public:
+
+    sf::Texture texture;
+
+    std::array<StripGlyph, STRIP_CHARACTERS_AMOUNT> glyphs;
+
+    float digitAdvance {0.f};
+    float colonAdvance {0.f};
+    float spaceAdvance {0.f};
+
+    unsigned int characterSize;
+};
+
+/**
+ *
+ */
+DigitsStrip::DigitsStrip(
+    const sf::Font& font,
+    const unsigned int& characterSize
+) :
+    impl(std::make_unique<Impl>())
+{
+    impl->characterSize = characterSize;
+
+    constexpr bool BOLD {false};
+
+    /* getGlyph() renders the glyph into the font page of the size,
+       the page is copied once when all the glyphs are rendered */
+    std::array<sf::IntRect, STRIP_CHARACTERS_AMOUNT> pageRects;
+
+    int stripWidth {GLYPHS_PADDING};
+    int stripHeight {0};
+
+    for (
+        std::size_t index {0};
+        index < STRIP_CHARACTERS_AMOUNT;
+        index += 1
+    )
+    {
+        const auto& glyph = font.getGlyph(
+            static_cast<sf::Uint32>(STRIP_CHARACTERS[index]),
+            characterSize,
+            BOLD
+        );
+
+        pageRects[index] = glyph.textureRect;
+
+        auto& stripGlyph = impl->glyphs[index];
+        stripGlyph.bounds = glyph.bounds;
+        stripGlyph.textureRect = sf::IntRect(
+            stripWidth,
+            GLYPHS_PADDING,
+            glyph.textureRect.width,
+            glyph.textureRect.height
+        );
+
+        stripWidth += glyph.textureRect.width + GLYPHS_PADDING;
+        stripHeight = std::max(stripHeight, glyph.textureRect.height);
+
+        if (index == COLON_INDEX)
+        {
+            impl->colonAdvance = glyph.advance;
+        }
+        else
+        {
+            impl->digitAdvance = std::max(impl->digitAdvance, glyph.advance);
+        }
+    }
+
+    impl->spaceAdvance = font.getGlyph(
+        static_cast<sf::Uint32>(' '),
+        characterSize,
+        BOLD
+    ).advance;
+
+    const sf::Image page = font.getTexture(characterSize).copyToImage();
+
+    sf::Image strip;
+    strip.create(
+        static_cast<unsigned int>(stripWidth),
+        static_cast<unsigned int>(stripHeight + GLYPHS_PADDING * 2),
+        sf::Color(255, 255, 255, 0)
+    );
+
+    for (
+        std::size_t index {0};
+        index < STRIP_CHARACTERS_AMOUNT;
+        index += 1
+    )
+    {
+        const auto& textureRect = impl->glyphs[index].textureRect;
+
+        strip.copy(
+            page,
+            static_cast<unsigned int>(textureRect.left),
+            static_cast<unsigned int>(textureRect.top),
+            pageRects[index]
+        );
+    }
+
+    auto& texture = impl->texture;
+    texture.loadFromImage(strip);
+    texture.setSmooth(true);
+}
+
+/**
+ *
+ */
+DigitsStrip::~DigitsStrip() = default;
+
+/**
+ *
+ */
+const sf::Texture& DigitsStrip::getTexture() const & noexcept
+{
+    return impl->texture;
+}
+
+/**
+ *
+ */
+const StripGlyph& DigitsStrip::getGlyph(const char& character) const &
+    noexcept
+{
+    if (character == ':')
+    {
+        return impl->glyphs[COLON_INDEX];
+    }
+
+    return impl->glyphs[static_cast<std::size_t>(character - '0')];
+}
+
+/**
+ *
+ */
+const float& DigitsStrip::getDigitAdvance() const & noexcept
+{
+    return impl->digitAdvance;
+}
+
+/**
+ *
+ */
+const float& DigitsStrip::getColonAdvance() const & noexcept
+{
+    return impl->colonAdvance;
+}
+
+/**
+ *
+ */
+const float& DigitsStrip::getSpaceAdvance() const & noexcept
+{
+    return impl->spaceAdvance;
+}
+
+/**
+ *
+ */
+const unsigned int& DigitsStrip::getCharacterSize() const & noexcept
+{
+    return impl->characterSize;
+}
+
+}
+}
@@ -0,0 +1,316 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file DigitsText.cpp
+ * @package widgets
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "DigitsText.hpp"
+
+#include "DigitsStrip.hpp"
+#include "ProfiledWindow.hpp"
+
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <array>
+#include <vector>
+#include <algorithm>
+
+namespace memoris
+{
+namespace widgets
+{
+
+constexpr unsigned short VERTICES_PER_CHARACTER {4};
+
+/* enough characters for any unsigned short value */
+constexpr unsigned short NUMBER_MAXIMUM_DIGITS {5};
+
+class DigitsText::Impl
+{
+
+public:
+
+    Impl(
+        const utils::DigitsStrip& strip,
+        const unsigned short& maximumCharacters
+    ) :
+        strip(strip),
+        vertices(maximumCharacters * VERTICES_PER_CHARACTER),
+        maximumCharacters(maximumCharacters)
+    {
+    }
+
+    const utils::DigitsStrip& strip;
+
+    /* allocated once, only the used vertices are drawn */
+    std::vector<sf::Vertex> vertices;
+
+    /* the characters are kept to update the quads when the text moves */
+    std::array<char, 8> characters;
+
+    float horizontalPosition {0.f};
+    float verticalPosition {0.f};
+    float width {0.f};
+
+    unsigned short charactersAmount {0};
+    unsigned short quadsAmount {0};
+    unsigned short maximumCharacters;
+};
+
+/**
+ *
+ */
+DigitsText::DigitsText(
+    const utils::DigitsStrip& strip,
+    const unsigned short& maximumCharacters
+) :
+    impl(
+        std::make_unique<Impl>(
+            strip,
+            maximumCharacters
+        )
+    )
+{
+}
+
+/**
+ *
+ */
+DigitsText::~DigitsText() = default;
+
+/**
+ *
+ */
+void DigitsText::display(utils::ProfiledWindow& window) const &
+{
+    const auto verticesAmount = impl->quadsAmount * VERTICES_PER_CHARACTER;
+
+    if (verticesAmount == 0)
+    {
+        return;
+    }
+
+    window.draw(
+        impl->vertices.data(),
+        verticesAmount,
+        sf::Quads,
+        sf::RenderStates(&impl->strip.getTexture())
+    );
+}
+
+/**
+ *
+ */
+void DigitsText::setNumber(const unsigned short& value) const & noexcept
+{
+    char digits[NUMBER_MAXIMUM_DIGITS];
+    unsigned short first {NUMBER_MAXIMUM_DIGITS};
+    unsigned short remaining {value};
+
+    /* written from the last digit, without any allocation */
+    do
+    {
+        first -= 1;
+        digits[first] = static_cast<char>('0' + remaining % 10);
+        remaining /= 10;
+    }
+    while (remaining != 0);
+
+    updateQuads(
+        digits + first,
+        NUMBER_MAXIMUM_DIGITS - first
+    );
+}
+
+/**
+ *
+ */
+void DigitsText::setClock(
+    const unsigned short& minutes,
+    const unsigned short& seconds
+) const & noexcept
+{
+    const char clock[] {
+        static_cast<char>('0' + minutes / 10 % 10),
+        static_cast<char>('0' + minutes % 10),
+        ' ',
+        ':',
+        ' ',
+        static_cast<char>('0' + seconds / 10 % 10),
+        static_cast<char>('0' + seconds % 10)
+    };
+
+    updateQuads(
+        clock,
+        sizeof(clock)
+    );
+}
+
+/**
+ *
+ */
+void DigitsText::setPosition(
+    const float& horizontalPosition,
+    const float& verticalPosition
+) const & noexcept
+{
+    impl->horizontalPosition = horizontalPosition;
+    impl->verticalPosition = verticalPosition;
+
+    updateQuads(
+        impl->characters.data(),
+        impl->charactersAmount
+    );
+}
+
+/**
+ *
+ */
+void DigitsText::setColor(const sf::Color& color) const & noexcept
+{
+    for (auto& vertex : impl->vertices)
+    {
+        vertex.color = color;
+    }
+}
+
+/**
+ *
+ */
+const float DigitsText::getWidth() const & noexcept
+{
+    return impl->width;
+}
+
+/**
+ *
+ */
+void DigitsText::updateQuads(
+    const char* characters,
+    const unsigned short& charactersAmount
+) const & noexcept
+{
+    const auto& strip = impl->strip;
+
+    const auto amount = std::min(
+        charactersAmount,
+        std::min(
+            impl->maximumCharacters,
+            static_cast<unsigned short>(impl->characters.size())
+        )
+    );
+
+    /* the characters are already the stored ones when the text moves,
+       all the quads are placed again in that case */
+    bool shifted = characters == impl->characters.data();
+
+    const auto previousAmount = impl->charactersAmount;
+
+    /* the glyphs are placed on the baseline, as SFML does for a text */
+    const float baseline = impl->verticalPosition +
+        static_cast<float>(strip.getCharacterSize());
+
+    float advance = impl->horizontalPosition;
+    unsigned short quadsAmount {0};
+
+    for (
+        unsigned short index {0};
+        index < amount;
+        index += 1
+    )
+    {
+        const char character = characters[index];
+        auto& previous = impl->characters[index];
+
+        /* the quad of an unchanged character is kept as long as all the
+           previous characters keep the same advance */
+        const bool unchanged =
+            not shifted and
+            index < previousAmount and
+            character == previous;
+
+        if (
+            index < previousAmount and (
+                (character == ' ') != (previous == ' ') or
+                (character == ':') != (previous == ':')
+            )
+        )
+        {
+            shifted = true;
+        }
+
+        previous = character;
+
+        if (character == ' ')
+        {
+            advance += strip.getSpaceAdvance();
+
+            continue;
+        }
+
+        if (not unchanged)
+        {
+            const auto& glyph = strip.getGlyph(character);
+            const auto& bounds = glyph.bounds;
+            const auto& rect = glyph.textureRect;
+
+            const float left = advance + bounds.left;
+            const float top = baseline + bounds.top;
+            const float right = left + bounds.width;
+            const float bottom = top + bounds.height;
+
+            const auto textureLeft = static_cast<float>(rect.left);
+            const auto textureTop = static_cast<float>(rect.top);
+            const auto textureRight =
+                static_cast<float>(rect.left + rect.width);
+            const auto textureBottom =
+                static_cast<float>(rect.top + rect.height);
+
+            sf::Vertex* quad =
+                &impl->vertices[quadsAmount * VERTICES_PER_CHARACTER];
+
+            quad[0].position = sf::Vector2f(left, top);
+            quad[1].position = sf::Vector2f(right, top);
+            quad[2].position = sf::Vector2f(right, bottom);
+            quad[3].position = sf::Vector2f(left, bottom);
+
+            quad[0].texCoords = sf::Vector2f(textureLeft, textureTop);
+            quad[1].texCoords = sf::Vector2f(textureRight, textureTop);
+            quad[2].texCoords = sf::Vector2f(textureRight, textureBottom);
+            quad[3].texCoords = sf::Vector2f(textureLeft, textureBottom);
+        }
+
+        advance += character == ':' ?
+            strip.getColonAdvance() :
+            strip.getDigitAdvance();
+
+        quadsAmount += 1;
+    }
+
+    /* the blank characters have no quad, only the filled quads are drawn */
+    impl->charactersAmount = amount;
+    impl->quadsAmount = quadsAmount;
+    impl->width = advance - impl->horizontalPosition;
+}
+
+}
+}
@@ -24,6 +24,8 @@
 
 #include "EditingLevelManager.hpp"
 
+#include "EditorJournal.hpp"
+
 namespace memoris
 {
 namespace managers
@@ -39,6 +41,8 @@ public:
     std::shared_ptr<entities::Level> level {nullptr};
 
     std::vector<char> cells;
+
+    utils::EditorJournal journal;
 };
 
 /**
@@ -114,5 +118,14 @@ const std::vector<char>& EditingLevelManager::getCellsBackup() const & noexcept
     return impl->cells;
 }
 
+/**
+ *
+ */
+const utils::EditorJournal& EditingLevelManager::getJournal() const &
+    noexcept
+{
+    return impl->journal;
+}
+
 }
 }
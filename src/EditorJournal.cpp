@@ -0,0 +1,262 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file EditorJournal.cpp
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "EditorJournal.hpp"
+
+#include "Level.hpp"
+
+#include <deque>
+#include <vector>
+#include <algorithm>
+
+namespace memoris
+{
+namespace utils
+{
+
+/* the oldest steps are forgotten when the history contains more changes,
+   so the journal never takes more than a few dozens of kilobytes */
+constexpr std::size_t MAX_JOURNAL_CHANGES {16384};
+
+namespace
+{
+
+struct CellChange
+{
+    unsigned short index;
+    char previousType;
+    char nextType;
+};
+
+using Step = std::vector<CellChange>;
+
+}
+
+class EditorJournal::Impl
+{
+
+public:
+
+    /**
+     * @brief adds the given step at the end of the undo history and
+     * forgets the oldest steps if the history is full
+     *
+     * @param step the step to add
+     */
+    void pushUndoStep(Step&& step) &
+    {
+        changesAmount += step.size();
+        undoSteps.push_back(std::move(step));
+
+        while (changesAmount > MAX_JOURNAL_CHANGES)
+        {
+            changesAmount -= undoSteps.front().size();
+            undoSteps.pop_front();
+        }
+    }
+
+    std::deque<Step> undoSteps;
+    std::vector<Step> redoSteps;
+
+    std::size_t changesAmount {0};
+
+    Step stroke;
+
+    bool strokeOpened {false};
+};
+
+/**
+ *
+ */
+EditorJournal::EditorJournal() :
+    impl(std::make_unique<Impl>())
+{
+}
+
+/**
+ *
+ */
+EditorJournal::~EditorJournal() = default;
+
+/**
+ *
+ */
+void EditorJournal::beginStroke() const &
+{
+    endStroke();
+
+    impl->strokeOpened = true;
+}
+
+/**
+ *
+ */
+void EditorJournal::endStroke() const &
+{
+    auto& stroke = impl->stroke;
+
+    impl->strokeOpened = false;
+
+    /* a cell painted back to its first type during the stroke
+       is not changed at all */
+    stroke.erase(
+        std::remove_if(
+            stroke.begin(),
+            stroke.end(),
+            [](const CellChange& change)
+            {
+                return change.previousType == change.nextType;
+            }
+        ),
+        stroke.end()
+    );
+
+    if (stroke.empty())
+    {
+        return;
+    }
+
+    impl->pushUndoStep(std::move(stroke));
+
+    stroke.clear();
+}
+
+/**
+ *
+ */
+void EditorJournal::recordCellChange(
+    const unsigned short& index,
+    const char& previousType,
+    const char& nextType
+) const &
+{
+    auto& stroke = impl->stroke;
+
+    impl->redoSteps.clear();
+
+    /* the last changes are the most likely to be painted again */
+    const auto change = std::find_if(
+        stroke.rbegin(),
+        stroke.rend(),
+        [&index](const CellChange& change)
+        {
+            return change.index == index;
+        }
+    );
+
+    if (change != stroke.rend())
+    {
+        change->nextType = nextType;
+    }
+    else
+    {
+        stroke.push_back(CellChange {index, previousType, nextType});
+    }
+
+    if (not impl->strokeOpened)
+    {
+        endStroke();
+    }
+}
+
+/**
+ *
+ */
+const bool EditorJournal::undo(const entities::Level& level) const &
+{
+    endStroke();
+
+    auto& undoSteps = impl->undoSteps;
+
+    if (undoSteps.empty())
+    {
+        return false;
+    }
+
+    Step step = std::move(undoSteps.back());
+    undoSteps.pop_back();
+    impl->changesAmount -= step.size();
+
+    /* in reverse order, for the coupled stairs cells */
+    std::for_each(
+        step.crbegin(),
+        step.crend(),
+        [&level](const CellChange& change)
+        {
+            level.setCellType(
+                change.index,
+                change.previousType
+            );
+        }
+    );
+
+    impl->redoSteps.push_back(std::move(step));
+
+    return true;
+}
+
+/**
+ *
+ */
+const bool EditorJournal::redo(const entities::Level& level) const &
+{
+    endStroke();
+
+    auto& redoSteps = impl->redoSteps;
+
+    if (redoSteps.empty())
+    {
+        return false;
+    }
+
+    Step step = std::move(redoSteps.back());
+    redoSteps.pop_back();
+
+    for (const auto& change : step)
+    {
+        level.setCellType(
+            change.index,
+            change.nextType
+        );
+    }
+
+    impl->pushUndoStep(std::move(step));
+
+    return true;
+}
+
+/**
+ *
+ */
+void EditorJournal::clear() const & noexcept
+{
+    impl->undoSteps.clear();
+    impl->redoSteps.clear();
+    impl->stroke.clear();
+    impl->changesAmount = 0;
+    impl->strokeOpened = false;
+}
+
+}
+}
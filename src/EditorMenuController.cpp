@@ -33,8 +33,8 @@
 #include "window.hpp"
 #include "SoundsManager.hpp"
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
 
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Window/Event.hpp>
 
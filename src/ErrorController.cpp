@@ -30,8 +30,8 @@
 #include "fonts_sizes.hpp"
 #include "window.hpp"
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
 
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Window/Event.hpp>
 
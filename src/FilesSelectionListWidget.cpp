@@ -28,15 +28,10 @@
 #include "FontsManager.hpp"
 #include "ColorsManager.hpp"
 #include "fonts_sizes.hpp"
+#include "ContentCatalog.hpp"
 
 #include <SFML/Graphics/Text.hpp>
 
-#include <cstring>
-#include <stdexcept>
-#include <string>
-
-#include <dirent.h> // C library
-
 namespace memoris
 {
 namespace widgets
@@ -49,16 +44,16 @@ public:
 
     Impl(
         const utils::Context& context,
-        const char* directory
+        const managers::ContentDirectory& directory
     ) :
         context(context),
-        directoryPath(directory)
+        directory(directory)
     {
     }
 
     const utils::Context& context;
 
-    const char* directoryPath;
+    const managers::ContentDirectory directory;
 };
 
 /**
@@ -66,7 +61,7 @@ public:
  */
 FilesSelectionListWidget::FilesSelectionListWidget(
     const utils::Context& context,
-    const char* directory,
+    const managers::ContentDirectory& directory,
     const float& horizontalPosition
 ) :
     SelectionListWidget(
@@ -75,7 +70,7 @@ FilesSelectionListWidget::FilesSelectionListWidget(
     ),
     impl(std::make_unique<Impl>(context, directory))
 {
-    loadFilesFromDirectory();
+    loadFilesFromCatalog();
 }
 
 /**
@@ -86,44 +81,15 @@ FilesSelectionListWidget::~FilesSelectionListWidget() = default;
 /**
  *
  */
-void FilesSelectionListWidget::loadFilesFromDirectory() const & noexcept
+void FilesSelectionListWidget::loadFilesFromCatalog() const &
 {
-    /* this function uses a C library (dirent.h), so it also uses old-C++
-       coding style (no smart pointer) */
-
-    /* pointer to a custom type of dirent.h used for reading steps */
-    struct dirent* reader = NULL;
-
-    /* pointer to the object managing the directory reading */
-    DIR* dir = opendir(impl->directoryPath);
-
-    /* NOTE: the code here segfault if the directory cannot be open;
-       we voluntary do not handle any exception in order to let
-       the program stops */
+    const auto& entries =
+        impl->context.getContentCatalog().getEntries(impl->directory);
 
-    while((reader = readdir(dir)) != NULL)
+    for (const auto& entry : entries)
     {
-        /* std::string operator= accepts const char* types */
-        std::string item = reader->d_name;
-
-        /* remove the file extension from the file name */
-        size_t extensionPosition = item.find_last_of(".");
-        item = item.substr(0, extensionPosition);
-
-        /* ignore special values */
-        if (
-            item == ".." ||
-            item == "." ||
-            item == ""
-        )
-        {
-            continue;
-        }
-
-        addItem(std::move(item));
+        addItem(std::string(entry.first));
     }
-
-    closedir(dir);
 }
 
 }
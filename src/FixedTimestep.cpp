@@ -0,0 +1,91 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file FixedTimestep.cpp
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "FixedTimestep.hpp"
+
+namespace memoris
+{
+namespace utils
+{
+
+/**
+ *
+ */
+FixedTimestep::FixedTimestep(
+    const sf::Int32& stepDuration,
+    const sf::Int32& startTime
+) noexcept :
+    stepDuration(stepDuration),
+    stepStartTime(startTime)
+{
+}
+
+/**
+ *
+ */
+void FixedTimestep::restart(const sf::Int32& time) & noexcept
+{
+    stepStartTime = time;
+}
+
+/**
+ *
+ */
+const unsigned int FixedTimestep::consumeSteps(const sf::Int32& time) &
+    noexcept
+{
+    if (time < stepStartTime)
+    {
+        restart(time);
+
+        return 0;
+    }
+
+    const auto steps = (time - stepStartTime) / stepDuration;
+
+    /* the remaining time is kept for the next step */
+    stepStartTime += steps * stepDuration;
+
+    return static_cast<unsigned int>(steps);
+}
+
+/**
+ *
+ */
+const float FixedTimestep::getInterpolation(const sf::Int32& time) const &
+    noexcept
+{
+    if (time < stepStartTime)
+    {
+        return 0.f;
+    }
+
+    const auto elapsed = static_cast<float>(time - stepStartTime) /
+        static_cast<float>(stepDuration);
+
+    return elapsed < 1.f ? elapsed : 1.f;
+}
+
+}
+}
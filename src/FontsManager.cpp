@@ -25,8 +25,14 @@
 
 #include "FontsManager.hpp"
 
+#include "ResourcesLoader.hpp"
+#include "resource_pack.hpp"
+#include "DigitsStrip.hpp"
+
 #include <SFML/Graphics/Font.hpp>
 
+#include <map>
+
 namespace memoris
 {
 namespace managers
@@ -40,16 +46,19 @@ public:
     sf::Font titleFont;
     sf::Font textFont;
     sf::Font tutorialFont;
+
+    /* one strip per size, only a few sizes are used by the game */
+    std::map<unsigned int, std::unique_ptr<utils::DigitsStrip>> digitsStrips;
 };
 
 /**
  *
  */
-FontsManager::FontsManager() :
+FontsManager::FontsManager(const utils::ResourcesLoader& loader) :
     impl(std::make_unique<Impl>())
 {
-    loadFontFromFile(impl->titleFont, "crystal_regular.ttf");
-    loadFontFromFile(impl->textFont, "hi.otf");
+    loadFontFromPack(impl->titleFont, loader, "crystal_regular.ttf");
+    loadFontFromPack(impl->textFont, loader, "hi.otf");
 }
 
 /**
@@ -76,12 +85,37 @@ const sf::Font& FontsManager::getTextFont() const & noexcept
 /**
  *
  */
-void FontsManager::loadFontFromFile(
+const utils::DigitsStrip& FontsManager::getTextDigitsStrip(
+    const unsigned int& characterSize
+) const &
+{
+    auto& strip = impl->digitsStrips[characterSize];
+
+    if (strip == nullptr)
+    {
+        strip = std::make_unique<utils::DigitsStrip>(
+            impl->textFont,
+            characterSize
+        );
+    }
+
+    return *strip;
+}
+
+/**
+ *
+ */
+void FontsManager::loadFontFromPack(
     sf::Font& font,
+    const utils::ResourcesLoader& loader,
     const std::string& path
 )
 {
-    if(!font.loadFromFile("res/fonts/" + path))
+    /* SFML reads the font bytes when the glyphs are rendered,
+       the pack stays mapped for the whole game */
+    const auto& data = loader.getResource("fonts/" + path);
+
+    if(!font.loadFromMemory(data.bytes, data.size))
     {
         throw std::invalid_argument("Cannot load font " + path);
     }
@@ -0,0 +1,272 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file FrameProfiler.cpp
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "FrameProfiler.hpp"
+
+#include <array>
+#include <atomic>
+#include <vector>
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+#include <stdexcept>
+
+namespace memoris
+{
+namespace utils
+{
+
+namespace
+{
+
+/* about one minute of frames at 60 frames per second */
+constexpr std::size_t RING_BUFFER_SIZE {4096};
+
+constexpr std::array<const char*, FrameProfiler::SECTIONS_AMOUNT>
+SECTIONS_NAMES {{
+    "loading",
+    "render",
+    "events",
+    "animation",
+    "draw",
+    "display"
+}};
+
+struct Frame
+{
+    std::uint64_t startTime {0};
+    std::uint32_t duration {0};
+    std::uint32_t drawCalls {0};
+
+    std::array<std::uint32_t, FrameProfiler::SECTIONS_AMOUNT> sections {{}};
+};
+
+}
+
+class FrameProfiler::Impl
+{
+
+public:
+
+    const std::chrono::steady_clock::time_point creationTime {
+        std::chrono::steady_clock::now()
+    };
+
+    /* the frames are only written by the main loop; the amount of written
+       frames is published after the frame is copied, so the ring buffer
+       can be read without lock (the oldest frame may be overwritten
+       during the reading, the readers always skip it) */
+    std::array<Frame, RING_BUFFER_SIZE> frames;
+    std::atomic<std::size_t> writtenFrames {0};
+
+    Frame currentFrame;
+};
+
+/**
+ *
+ */
+FrameProfiler::FrameProfiler() : impl(std::make_unique<Impl>())
+{
+}
+
+/**
+ *
+ */
+FrameProfiler::~FrameProfiler() = default;
+
+/**
+ *
+ */
+const std::uint64_t FrameProfiler::getTime() const & noexcept
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - impl->creationTime
+        ).count()
+    );
+}
+
+/**
+ *
+ */
+void FrameProfiler::startFrame() const & noexcept
+{
+    auto& frame = impl->currentFrame;
+    frame.startTime = getTime();
+    frame.drawCalls = 0;
+    frame.sections.fill(0);
+}
+
+/**
+ *
+ */
+void FrameProfiler::endFrame() const & noexcept
+{
+    auto& frame = impl->currentFrame;
+    frame.duration = static_cast<std::uint32_t>(
+        getTime() - frame.startTime
+    );
+
+    const auto index = impl->writtenFrames.load(std::memory_order_relaxed);
+    impl->frames[index % RING_BUFFER_SIZE] = frame;
+    impl->writtenFrames.store(index + 1, std::memory_order_release);
+}
+
+/**
+ *
+ */
+void FrameProfiler::addSectionTime(
+    const Section& section,
+    const std::uint64_t& startTime
+) const & noexcept
+{
+    impl->currentFrame.sections[static_cast<std::size_t>(section)] +=
+        static_cast<std::uint32_t>(getTime() - startTime);
+}
+
+/**
+ *
+ */
+void FrameProfiler::addDrawCall() const & noexcept
+{
+    impl->currentFrame.drawCalls += 1;
+}
+
+/**
+ *
+ */
+FrameProfiler::Statistics FrameProfiler::getStatistics() const &
+{
+    Statistics statistics;
+
+    const auto writtenFrames =
+        impl->writtenFrames.load(std::memory_order_acquire);
+
+    if (writtenFrames == 0)
+    {
+        return statistics;
+    }
+
+    /* the oldest frame is skipped as it may be overwritten now */
+    const auto framesAmount = std::min(
+        writtenFrames,
+        RING_BUFFER_SIZE - 1
+    );
+
+    std::vector<std::uint32_t> durations;
+    durations.reserve(framesAmount);
+
+    for (
+        auto index = writtenFrames - framesAmount;
+        index < writtenFrames;
+        index += 1
+    )
+    {
+        durations.push_back(impl->frames[index % RING_BUFFER_SIZE].duration);
+    }
+
+    const auto median = durations.begin() + durations.size() / 2;
+    std::nth_element(durations.begin(), median, durations.end());
+    statistics.medianFrameTime = *median;
+
+    constexpr std::size_t SLOW_FRAMES_PERCENTILE {99};
+    const auto slow = durations.begin() +
+        (durations.size() - 1) * SLOW_FRAMES_PERCENTILE / 100;
+    std::nth_element(durations.begin(), slow, durations.end());
+    statistics.slowFrameTime = *slow;
+
+    statistics.drawCalls =
+        impl->frames[(writtenFrames - 1) % RING_BUFFER_SIZE].drawCalls;
+    statistics.framesAmount = framesAmount;
+
+    return statistics;
+}
+
+/**
+ *
+ */
+void FrameProfiler::writeChromeTrace(const std::string& filePath) const &
+{
+    std::ofstream file(filePath);
+
+    if (not file.is_open())
+    {
+        throw std::invalid_argument("Cannot write the trace file");
+    }
+
+    const auto writtenFrames =
+        impl->writtenFrames.load(std::memory_order_acquire);
+    const auto framesAmount = std::min(
+        writtenFrames,
+        RING_BUFFER_SIZE - 1
+    );
+
+    /* the frames are complete events ("X"); the sections are not recorded
+       with their own start times, so they are written as arguments of
+       the frame, the draw calls are also written as a counter ("C") */
+    file << "{\"traceEvents\":[";
+
+    for (
+        auto index = writtenFrames - framesAmount;
+        index < writtenFrames;
+        index += 1
+    )
+    {
+        const auto& frame = impl->frames[index % RING_BUFFER_SIZE];
+
+        if (index != writtenFrames - framesAmount)
+        {
+            file << ",";
+        }
+
+        file << "\n{\"name\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+            << "\"ts\":" << frame.startTime << ","
+            << "\"dur\":" << frame.duration << ",\"args\":{";
+
+        for (
+            std::size_t section {0};
+            section < SECTIONS_AMOUNT;
+            section += 1
+        )
+        {
+            file << "\"" << SECTIONS_NAMES[section] << "_us\":"
+                << frame.sections[section] << ",";
+        }
+
+        file << "\"draw_calls\":" << frame.drawCalls << "}},"
+            << "\n{\"name\":\"draw calls\",\"ph\":\"C\",\"pid\":1,"
+            << "\"ts\":" << frame.startTime << ","
+            << "\"args\":{\"calls\":" << frame.drawCalls << "}}";
+    }
+
+    file << "\n]}\n";
+
+    if (not file.good())
+    {
+        throw std::invalid_argument("Cannot write the trace file");
+    }
+}
+
+}
+}
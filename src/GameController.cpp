@@ -36,26 +36,34 @@
 #include "TexturesManager.hpp"
 #include "Level.hpp"
 #include "EditingLevelManager.hpp"
-#include "Cell.hpp"
 #include "PickUpEffect.hpp"
 #include "Context.hpp"
 #include "dimensions.hpp"
+#include "game_state.hpp"
+#include "level_files.hpp"
+#include "replays.hpp"
+#include "FrameProfiler.hpp"
+#include "FixedTimestep.hpp"
 
 #include "HorizontalMirrorAnimation.hpp"
 #include "VerticalMirrorAnimation.hpp"
 #include "StairsAnimation.hpp"
 #include "DiagonalAnimation.hpp"
 #include "RotateFloorAnimation.hpp"
+#include "ProfiledWindow.hpp"
 
 #include <SFML/Window/Keyboard.hpp>
 #include <SFML/Window/Event.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
+
+#include <algorithm>
 
 namespace memoris
 {
 namespace controllers
 {
 
+constexpr sf::Int32 ONE_SECOND {1000};
+
 class GameController::Impl
 {
 
@@ -64,7 +72,8 @@ public:
     Impl(
         const utils::Context& context,
         const std::shared_ptr<entities::Level>& level,
-        const unsigned short& watchingTime
+        const unsigned short& watchingTime,
+        const std::shared_ptr<const replays::Replay>& playedReplay
     ) :
         displayedWatchingTime(watchingTime),
         level(level),
@@ -81,9 +90,35 @@ public:
             context,
             watchingTime
         ),
-        editedLevel(context.getEditingLevelManager().getLevel())
+        editedLevel(context.getEditingLevelManager().getLevel()),
+        playedReplay(playedReplay),
+        seconds(
+            ONE_SECOND,
+            context.getClockMillisecondsTime()
+        )
     {
         hasWatchingPeriod = (watchingTime != 0);
+
+        auto& data = replay.level;
+
+        const auto cells = level->getCharactersList();
+        std::copy(
+            cells.cbegin(),
+            cells.cend(),
+            data.cells.begin()
+        );
+
+        data.minutes = level->getMinutes();
+        data.seconds = level->getSeconds();
+        data.starsAmount = level->getStarsAmount();
+        data.departureIndex = level->getPlayerCellIndex();
+        data.lastPlayableFloor = level->getLastPlayableFloor();
+
+        replay.lifes = dashboard.getLifes();
+        replay.watchingTime = dashboard.getWatchingTime();
+        replay.displayedWatchingTime = watchingTime;
+
+        state = replays::createReplayGameState(replay);
     }
 
     sf::Uint32 playerCellAnimationTime {0};
@@ -93,7 +128,6 @@ public:
 
     unsigned short floor {0};
     unsigned short displayedWatchingTime {0};
-    unsigned short playingTime {0};
     unsigned short endingScreenSeconds {0};
 
     bool watchingPeriod {true};
@@ -102,8 +136,6 @@ public:
 
     sf::Uint8 playerCellTransparency {64};
 
-    sf::Int32 lastTime {0};
-
     std::unique_ptr<utils::AbstractLevelEndingScreen> endingScreen {nullptr};
     std::unique_ptr<animations::LevelAnimation> animation {nullptr};
 
@@ -123,6 +155,20 @@ public:
     std::vector<std::unique_ptr<utils::PickUpEffect>> effects;
 
     const std::shared_ptr<entities::Level>& editedLevel;
+
+    /* the rules of the game are applied on this state, the level and the
+       widgets only render the state changes */
+    game::GameState state;
+
+    /* every action applied on the game state is recorded with its time,
+       so the same game can be played again */
+    replays::Replay replay;
+
+    /* the replay played instead of the player inputs, if any */
+    std::shared_ptr<const replays::Replay> playedReplay;
+    std::size_t nextReplayStep {0};
+
+    utils::FixedTimestep seconds;
 };
 
 /**
@@ -131,14 +177,16 @@ public:
 GameController::GameController(
     const utils::Context& context,
     const std::shared_ptr<entities::Level>& level,
-    const unsigned short& watchingTime
+    const unsigned short& watchingTime,
+    const std::shared_ptr<const replays::Replay>& replay
 ) :
     Controller(context),
     impl(
         std::make_unique<Impl>(
             context,
             level,
-            watchingTime
+            watchingTime,
+            replay
         )
     )
 {
@@ -177,8 +225,16 @@ void GameController::handleAnimation() const &
 {
     auto& animation = impl->animation;
 
+    const auto& profiler = getContext().getFrameProfiler();
+    const auto startTime = profiler.getTime();
+
     animation->renderAnimation();
 
+    profiler.addSectionTime(
+        utils::FrameProfiler::Section::Animation,
+        startTime
+    );
+
     if (animation->isFinished())
     {
         auto& floorMovement = impl->floorMovement;
@@ -220,6 +276,13 @@ void GameController::handlePlayerCellAnimation() const &
 void GameController::handlePickupEffects() const &
 {
     auto& effects = impl->effects;
+
+    /* the frame that removes the last effect is also drawn */
+    if (not effects.empty())
+    {
+        getContext().getSfmlWindow().invalidate();
+    }
+
     auto iterator = effects.begin();
 
     while (iterator != effects.end())
@@ -239,56 +302,196 @@ void GameController::handlePickupEffects() const &
 /**
  *
  */
-void GameController::handlePlayerMovement(const sf::Event& event) const &
+void GameController::applyAction(const game::Action& action) const &
 {
-    const auto& level = impl->level;
+    const auto previousStatus = impl->state.status;
 
-    level->showPlayerCell();
+    if (impl->playedReplay == nullptr)
+    {
+        impl->replay.steps.push_back(
+            {
+                static_cast<unsigned int>(
+                    getContext().getClockMillisecondsTime()
+                ),
+                action
+            }
+        );
+    }
 
-    const auto& playerCellType = level->getPlayerCellType();
+    if (action == game::Action::Second)
+    {
+        handleOneSecond();
+    }
+    else
+    {
+        handlePlayerAction(action);
+    }
 
-    if (
-        playerCellType != cells::EMPTY_CELL and
-        playerCellType != cells::DEPARTURE_CELL and
-        playerCellType != cells::STAIRS_UP_CELL and
-        playerCellType != cells::STAIRS_DOWN_CELL and
-        playerCellType != cells::ARRIVAL_CELL
-    )
+    if (impl->state.status != previousStatus)
     {
-        level->emptyPlayerCell();
+        saveReplay();
     }
+}
 
-    switch(event.key.code)
+/**
+ *
+ */
+void GameController::handleOneSecond() const &
+{
+    const auto result = game::step(
+        impl->state,
+        game::Action::Second
+    );
+
+    const auto& timerWidget = impl->timerWidget;
+
+    if (timerWidget.isStarted())
     {
-    case sf::Keyboard::Up:
+        timerWidget.decrementPlayingTimer();
+    }
+
+    if (result.event == game::Event::TimeOver)
     {
-        level->makeTopMovement();
+        endGame();
+    }
+}
 
-        break;
+/**
+ *
+ */
+void GameController::playReplaySteps() const &
+{
+    const auto& steps = impl->playedReplay->steps;
+    const auto time = static_cast<unsigned int>(
+        getContext().getClockMillisecondsTime()
+    );
+
+    auto& nextStep = impl->nextReplayStep;
+
+    while (
+        nextStep < steps.size() and
+        steps[nextStep].time <= time
+    )
+    {
+        const auto& action = steps[nextStep].action;
+
+        /* the movements wait for the end of the animations, exactly like
+           the player had to wait when the replay was recorded */
+        if (
+            action != game::Action::Second and
+            not isPlayerMovementAllowed()
+        )
+        {
+            break;
+        }
+
+        applyAction(action);
+
+        nextStep += 1;
     }
-    case sf::Keyboard::Down:
+}
+
+/**
+ *
+ */
+void GameController::saveReplay() const &
+{
+    if (impl->playedReplay != nullptr)
     {
-        level->makeBottomMovement();
+        return;
+    }
+
+    auto& replay = impl->replay;
+    replay.status = impl->state.status;
+
+    try
+    {
+        replays::writeReplayFile(
+            replays::LAST_REPLAY_FILE_PATH,
+            replay
+        );
+    }
+    catch(std::invalid_argument&)
+    {
+        /* the replay is not required to play,
+           the game goes on without the file */
+    }
+}
+
+/**
+ *
+ */
+const bool GameController::isPlayerMovementAllowed() const & noexcept
+{
+    return
+        not impl->watchingPeriod and
+        not impl->endPeriodStartTime and
+        impl->animation == nullptr;
+}
+
+/**
+ *
+ */
+void GameController::handlePlayerAction(const game::Action& action) const &
+{
+    const auto result = game::step(
+        impl->state,
+        action
+    );
+
+    switch(result.event)
+    {
+    case game::Event::WallCollision:
+    {
+        impl->level->showCell(result.cellIndex);
+
+        getContext().getSoundsManager().playCollisionSound();
 
         break;
     }
-    case sf::Keyboard::Left:
+    case game::Event::BorderCollision:
     {
-        level->makeLeftMovement();
+        getContext().getSoundsManager().playCollisionSound();
 
         break;
     }
     default:
     {
-        level->makeRightMovement();
+        handlePlayerMovement(result);
 
         break;
     }
     }
+}
+
+/**
+ *
+ */
+void GameController::handlePlayerMovement(const game::StepResult& result)
+    const &
+{
+    const auto& level = impl->level;
+
+    level->showPlayerCell();
+
+    if (result.leftCellEmptied)
+    {
+        level->emptyPlayerCell();
+    }
+
+    level->setPlayerCellIndex(result.cellIndex);
 
     level->showPlayerCell();
 
-    executePlayerCellAction();
+    executePlayerCellAction(result.event);
+}
+
+/**
+ *
+ */
+const bool GameController::isRedrawTracked() const & noexcept
+{
+    return true;
 }
 
 /**
@@ -312,17 +515,26 @@ const ControllerId& GameController::render() const &
     const auto& timerWidget = impl->timerWidget;
     timerWidget.display();
 
-    constexpr sf::Int32 ONE_SECOND {1000};
     const auto time = context.getClockMillisecondsTime();
     const auto& level = impl->level;
     const auto& floor = impl->floor;
     const auto& endingScreen = impl->endingScreen;
 
-    auto& lastTime = impl->lastTime;
     auto& animation = impl->animation;
     auto& editedLevel = impl->editedLevel;
 
-    if (time - lastTime > ONE_SECOND)
+    /* the seconds are counted from a fixed origin, so the frames
+       duration does not delay the timers; every second elapsed since the
+       previous frame is played, until the level ends or the controller
+       changes */
+    const auto seconds = impl->seconds.consumeSteps(time);
+    const bool endingScreenDisplayed = endingScreen != nullptr;
+
+    for (
+        unsigned int second {0};
+        second < seconds;
+        second += 1
+    )
     {
         if (endingScreen != nullptr)
         {
@@ -336,6 +548,10 @@ const ControllerId& GameController::render() const &
                 {
                     setExpectedControllerId(ControllerId::LevelEditor);
                 }
+                else if (impl->playedReplay != nullptr)
+                {
+                    setExpectedControllerId(ControllerId::MainMenu);
+                }
                 else if (impl->win)
                 {
                     setExpectedControllerId(ControllerId::Game);
@@ -375,29 +591,35 @@ const ControllerId& GameController::render() const &
 
         const auto timerStarted = timerWidget.isStarted();
 
-        auto& playingTime = impl->playingTime;
+        /* the seconds of a replay are applied with its other steps,
+           at the recorded times */
         if (
-            editedLevel != nullptr or
-            timerStarted
+            (
+                editedLevel != nullptr or
+                timerStarted
+            ) and
+            impl->playedReplay == nullptr
         )
         {
-            playingTime += 1;
+            applyAction(game::Action::Second);
         }
 
-        if (timerStarted)
-        {
-            timerWidget.decrementPlayingTimer();
-
-            if(
-                timerWidget.isTimeOver() and
-                impl->hasWatchingPeriod
+        if (
+            getExpectedControllerId() != ControllerId::NoController or
+            (
+                not endingScreenDisplayed and
+                endingScreen != nullptr
             )
-            {
-                endGame();
-            }
+        )
+        {
+            break;
         }
+    }
 
-        lastTime = time;
+    /* the animations and the ending screens change at every frame */
+    if (animation != nullptr or endingScreen != nullptr)
+    {
+        context.getSfmlWindow().invalidate();
     }
 
     if (animation != nullptr)
@@ -429,6 +651,11 @@ const ControllerId& GameController::render() const &
 
     handlePickupEffects();
 
+    if (impl->playedReplay != nullptr)
+    {
+        playReplaySteps();
+    }
+
     setNextControllerId(animateScreenTransition(context));
 
     auto& event = getEvent();
@@ -438,40 +665,52 @@ const ControllerId& GameController::render() const &
         {
         case sf::Event::KeyPressed:
         {
+            const bool playerCanMove =
+                isPlayerMovementAllowed() and
+                impl->playedReplay == nullptr;
+
             switch(event.key.code)
             {
             case sf::Keyboard::Up:
-            case sf::Keyboard::Down:
-            case sf::Keyboard::Left:
-            case sf::Keyboard::Right:
             {
-                if (
-                    impl->watchingPeriod or
-                    impl->endPeriodStartTime or
-                    animation != nullptr
-                )
+                if (playerCanMove)
                 {
-                    break;
+                    applyAction(game::Action::Up);
                 }
 
-                const bool movementAllowed = level->isPlayerMovementAllowed(
-                    event,
-                    floor
-                );
-
-                if (not movementAllowed)
+                break;
+            }
+            case sf::Keyboard::Down:
+            {
+                if (playerCanMove)
                 {
-                    context.getSoundsManager().playCollisionSound();
+                    applyAction(game::Action::Down);
+                }
 
-                    break;
+                break;
+            }
+            case sf::Keyboard::Left:
+            {
+                if (playerCanMove)
+                {
+                    applyAction(game::Action::Left);
                 }
 
-                handlePlayerMovement(event);
+                break;
+            }
+            case sf::Keyboard::Right:
+            {
+                if (playerCanMove)
+                {
+                    applyAction(game::Action::Right);
+                }
 
                 break;
             }
             case sf::Keyboard::Escape:
             {
+                saveReplay();
+
                 if (context.getEditingLevelManager().getLevel() != nullptr)
                 {
                     setExpectedControllerId(ControllerId::LevelEditor);
@@ -479,6 +718,13 @@ const ControllerId& GameController::render() const &
                     break;
                 }
 
+                if (impl->playedReplay != nullptr)
+                {
+                    setExpectedControllerId(ControllerId::MainMenu);
+
+                    break;
+                }
+
                 selectMenuControllerForExit();
 
                 break;
@@ -502,23 +748,22 @@ const ControllerId& GameController::render() const &
 /**
  *
  */
-void GameController::executePlayerCellAction() const &
+void GameController::executePlayerCellAction(const game::Event& event)
+    const &
 {
-    using namespace dimensions;
-
     const auto& level = impl->level;
-    const auto& newPlayerCellType = level->getPlayerCellType();
     const auto& context = getContext();
     const auto& dashboard = impl->dashboard;
     const auto& soundsManager = context.getSoundsManager();
     const auto& floor = impl->floor;
+    const auto& state = impl->state;
 
     auto& animation = impl->animation;
     auto& floorMovement = impl->floorMovement;
 
-    switch(newPlayerCellType)
+    switch(event)
     {
-    case cells::STAR_CELL:
+    case game::Event::FoundStar:
     {
         soundsManager.playFoundStarSound();
 
@@ -535,7 +780,7 @@ void GameController::executePlayerCellAction() const &
 
         break;
     }
-    case cells::MORE_LIFE_CELL:
+    case game::Event::FoundLife:
     {
         soundsManager.playFoundLifeOrTimeSound();
 
@@ -543,11 +788,11 @@ void GameController::executePlayerCellAction() const &
 
         break;
     }
-    case cells::LESS_LIFE_CELL:
+    case game::Event::LostLife:
     {
         soundsManager.playFoundDeadOrLessTimeSound();
 
-        if (dashboard.getLifes() == 0)
+        if (state.status == game::Status::Lost)
         {
             endGame();
 
@@ -558,7 +803,7 @@ void GameController::executePlayerCellAction() const &
 
         break;
     }
-    case cells::MORE_TIME_CELL:
+    case game::Event::MoreTime:
     {
         soundsManager.playFoundLifeOrTimeSound();
 
@@ -566,67 +811,54 @@ void GameController::executePlayerCellAction() const &
 
         break;
     }
-    case cells::LESS_TIME_CELL:
+    case game::Event::LessTime:
     {
         soundsManager.playFoundDeadOrLessTimeSound();
 
-        constexpr unsigned short MINIMUM_WATCHING_TIME {3};
-        if (dashboard.getWatchingTime() != MINIMUM_WATCHING_TIME)
+        if (dashboard.getWatchingTime() != state.watchingTime)
         {
             dashboard.decreaseWatchingTime();
         }
 
         break;
     }
-    case cells::ARRIVAL_CELL:
+    case game::Event::Win:
     {
-        if (
-            dashboard.getFoundStarsAmount() ==
-            level->getStarsAmount()
-        )
-        {
-            impl->win = true;
+        impl->win = true;
 
-            const auto& playingSerieManager = context.getPlayingSerieManager();
-            const auto& playingTime = impl->playingTime;
+        const auto& playingSerieManager = context.getPlayingSerieManager();
+        const auto& playingTime = state.playingTime;
 
-            playingSerieManager.addSecondsToPlayingSerieTime(playingTime);
+        playingSerieManager.addSecondsToPlayingSerieTime(playingTime);
 
-            if (impl->editedLevel != nullptr)
-            {
-                constexpr unsigned short SECONDS_PER_MINUTE {60};
-                level->setSeconds(playingTime % SECONDS_PER_MINUTE);
-                level->setMinutes(playingTime / SECONDS_PER_MINUTE);
+        if (impl->editedLevel != nullptr)
+        {
+            constexpr unsigned short SECONDS_PER_MINUTE {60};
+            level->setSeconds(playingTime % SECONDS_PER_MINUTE);
+            level->setMinutes(playingTime / SECONDS_PER_MINUTE);
 
-                setExpectedControllerId(ControllerId::LevelEditor);
+            setExpectedControllerId(ControllerId::LevelEditor);
 
-                return;
-            }
+            return;
+        }
 
-            if (playingSerieManager.hasNextLevel())
-            {
-                endGame();
-            }
-            else
-            {
-                setExpectedControllerId(ControllerId::WinSerie);
-            }
+        if (
+            playingSerieManager.hasNextLevel() or
+            impl->playedReplay != nullptr
+        )
+        {
+            endGame();
+        }
+        else
+        {
+            setExpectedControllerId(ControllerId::WinSerie);
         }
 
         break;
     }
-    case cells::STAIRS_UP_CELL:
-    case cells::ELEVATOR_UP_CELL:
+    case game::Event::FloorUp:
     {
-        unsigned short index = level->getPlayerCellIndex();
-        const unsigned short nextFloorIndex = index + CELLS_PER_FLOOR;
-
-        if (nextFloorIndex > CELLS_PER_LEVEL)
-        {
-            break;
-        }
-
-        level->setPlayerCellIndex(nextFloorIndex);
+        level->setPlayerCellIndex(state.playerIndex);
 
         level->showPlayerCell();
 
@@ -641,18 +873,9 @@ void GameController::executePlayerCellAction() const &
 
         break;
     }
-    case cells::STAIRS_DOWN_CELL:
-    case cells::ELEVATOR_DOWN_CELL:
+    case game::Event::FloorDown:
     {
-        unsigned short index = level->getPlayerCellIndex();
-        const unsigned short previousFloorIndex = index - CELLS_PER_FLOOR;
-
-        if (previousFloorIndex < 0)
-        {
-            break;
-        }
-
-        level->setPlayerCellIndex(previousFloorIndex);
+        level->setPlayerCellIndex(state.playerIndex);
 
         level->showPlayerCell();
 
@@ -667,7 +890,7 @@ void GameController::executePlayerCellAction() const &
 
         break;
     }
-    case cells::HORIZONTAL_MIRROR_CELL:
+    case game::Event::HorizontalMirror:
     {
         animation = std::make_unique<animations::HorizontalMirrorAnimation>(
             context,
@@ -677,7 +900,7 @@ void GameController::executePlayerCellAction() const &
 
         break;
     }
-    case cells::VERTICAL_MIRROR_CELL:
+    case game::Event::VerticalMirror:
     {
         animation = std::make_unique<animations::VerticalMirrorAnimation>(
             context,
@@ -687,7 +910,7 @@ void GameController::executePlayerCellAction() const &
 
         break;
     }
-    case cells::DIAGONAL_CELL:
+    case game::Event::Diagonal:
     {
         animation = std::make_unique<animations::DiagonalAnimation>(
             context,
@@ -697,7 +920,7 @@ void GameController::executePlayerCellAction() const &
 
         break;
     }
-    case cells::LEFT_ROTATION_CELL:
+    case game::Event::LeftRotation:
     {
         animation = std::make_unique<animations::RotateFloorAnimation>(
             context,
@@ -708,7 +931,7 @@ void GameController::executePlayerCellAction() const &
 
         break;
     }
-    case cells::RIGHT_ROTATION_CELL:
+    case game::Event::RightRotation:
     {
         animation = std::make_unique<animations::RotateFloorAnimation>(
             context,
@@ -719,6 +942,10 @@ void GameController::executePlayerCellAction() const &
 
         break;
     }
+    default:
+    {
+        break;
+    }
     }
 }
 
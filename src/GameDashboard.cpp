@@ -32,10 +32,10 @@
 #include "TexturesManager.hpp"
 #include "LevelSeparators.hpp"
 #include "TimerWidget.hpp"
+#include "ProfiledWindow.hpp"
+#include "DigitsText.hpp"
 
-#include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Sprite.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
 
 namespace memoris
 {
@@ -44,53 +44,56 @@ namespace utils
 
 constexpr unsigned short WATCHING_TIME_UPDATE_STEP {3};
 
+/* enough characters for any unsigned short value */
+constexpr unsigned short COUNTERS_MAXIMUM_DIGITS {5};
+
 class GameDashboard::Impl
 {
 
 public:
 
-    Impl(const utils::Context& context) :
+    Impl(
+        const utils::Context& context,
+        const DigitsStrip& strip
+    ) :
         window(context.getSfmlWindow()),
+        foundStarsAmount(strip, COUNTERS_MAXIMUM_DIGITS),
+        target(strip, COUNTERS_MAXIMUM_DIGITS),
+        floor(strip, COUNTERS_MAXIMUM_DIGITS),
+        lifesAmount(strip, COUNTERS_MAXIMUM_DIGITS),
+        time(strip, COUNTERS_MAXIMUM_DIGITS),
         separators(context)
     {
-        foundStarsAmount.setString("0");
-        target.setString("0");
-        floor.setString("1");
+        foundStarsAmount.setNumber(0);
+        target.setNumber(0);
+        floor.setNumber(1);
 
         const auto& white = context.getColorsManager().getColorWhite();
-        foundStarsAmount.setFillColor(white);
-        lifesAmount.setFillColor(white);
-        target.setFillColor(white);
-        time.setFillColor(white);
-        floor.setFillColor(white);
-
-        const auto& fontSize = sizes::TEXT_SIZE;
-        foundStarsAmount.setCharacterSize(fontSize);
-        lifesAmount.setCharacterSize(fontSize);
-        target.setCharacterSize(fontSize);
-        time.setCharacterSize(fontSize);
-        floor.setCharacterSize(fontSize);
-
-        const auto& font = context.getFontsManager().getTextFont();
-        foundStarsAmount.setFont(font);
-        lifesAmount.setFont(font);
-        target.setFont(font);
-        time.setFont(font);
-        floor.setFont(font);
+        foundStarsAmount.setColor(white);
+        lifesAmount.setColor(white);
+        target.setColor(white);
+        time.setColor(white);
+        floor.setColor(white);
 
         const auto& playingSerie = context.getPlayingSerieManager();
         watchingTime = playingSerie.getWatchingTime();
         lifes = playingSerie.getLifesAmount();
 
-        lifesAmount.setString(std::to_string(lifes));
-        time.setString(std::to_string(watchingTime));
+        lifesAmount.setNumber(lifes);
+        time.setNumber(watchingTime);
 
         const auto& texturesManager = context.getTexturesManager();
-        spriteStar.setTexture(texturesManager.getStarTexture());
-        spriteLife.setTexture(texturesManager.getLifeTexture());
-        spriteTarget.setTexture(texturesManager.getTargetTexture());
-        spriteTime.setTexture(texturesManager.getTimeTexture());
-        spriteFloor.setTexture(texturesManager.getFloorTexture());
+        starTexture = texturesManager.getStarTexture();
+        lifeTexture = texturesManager.getLifeTexture();
+        targetTexture = texturesManager.getTargetTexture();
+        timeTexture = texturesManager.getTimeTexture();
+        floorTexture = texturesManager.getFloorTexture();
+
+        spriteStar.setTexture(*starTexture);
+        spriteLife.setTexture(*lifeTexture);
+        spriteTarget.setTexture(*targetTexture);
+        spriteTime.setTexture(*timeTexture);
+        spriteFloor.setTexture(*floorTexture);
 
         constexpr float FIRST_LINE_ITEMS_VERTICAL_POSITION {0.f};
 
@@ -127,13 +130,22 @@ public:
         );
     }
 
-    sf::RenderWindow& window;
+    utils::ProfiledWindow& window;
+
+    /* the counters change during the whole game, they are drawn from
+       the digits strip instead of SFML texts */
+    widgets::DigitsText foundStarsAmount;
+    widgets::DigitsText target;
+    widgets::DigitsText floor;
+    widgets::DigitsText lifesAmount;
+    widgets::DigitsText time;
 
-    sf::Text foundStarsAmount;
-    sf::Text target;
-    sf::Text floor;
-    sf::Text lifesAmount;
-    sf::Text time;
+    /* the textures are kept as long as the dashboard exists */
+    managers::TextureHandle starTexture;
+    managers::TextureHandle lifeTexture;
+    managers::TextureHandle targetTexture;
+    managers::TextureHandle timeTexture;
+    managers::TextureHandle floorTexture;
 
     sf::Sprite spriteStar;
     sf::Sprite spriteTarget;
@@ -155,7 +167,12 @@ GameDashboard::GameDashboard(
     const utils::Context& context,
     const unsigned short& totalStarsAmount
 ) :
-    impl(std::make_unique<Impl>(context))
+    impl(
+        std::make_unique<Impl>(
+            context,
+            context.getFontsManager().getTextDigitsStrip(sizes::TEXT_SIZE)
+        )
+    )
 {
     /* we set the positions of the text surfaces in this class constructor
        and not in the implementation constructor; in fact, the method
@@ -227,10 +244,7 @@ GameDashboard::GameDashboard(
         SECOND_LINE_TEXTS_VERTICAL_POSITION
     );
 
-    updateSfmlTextByNumericValue(
-        impl->target,
-        totalStarsAmount
-    );
+    impl->target.setNumber(totalStarsAmount);
 }
 
 /**
@@ -245,11 +259,11 @@ void GameDashboard::display() const &
 {
     auto& window = impl->window;
 
-    window.draw(impl->foundStarsAmount);
-    window.draw(impl->lifesAmount);
-    window.draw(impl->target);
-    window.draw(impl->time);
-    window.draw(impl->floor);
+    impl->foundStarsAmount.display(window);
+    impl->lifesAmount.display(window);
+    impl->target.display(window);
+    impl->time.display(window);
+    impl->floor.display(window);
 
     window.draw(impl->spriteStar);
     window.draw(impl->spriteLife);
@@ -287,84 +301,78 @@ const unsigned short& GameDashboard::getFoundStarsAmount() const & noexcept
 /**
  *
  */
-void GameDashboard::incrementFoundStars() const &
+void GameDashboard::incrementFoundStars() const & noexcept
 {
     auto& foundStars = impl->foundStars;
     foundStars += 1;
 
-    updateSfmlTextByNumericValue(
-        impl->foundStarsAmount,
-        foundStars
-    );
+    impl->foundStarsAmount.setNumber(foundStars);
+
+    impl->window.invalidate();
 }
 
 /**
  *
  */
-void GameDashboard::incrementLifes() const &
+void GameDashboard::incrementLifes() const & noexcept
 {
     auto& lifes = impl->lifes;
     lifes += 1;
 
-    updateSfmlTextByNumericValue(
-        impl->lifesAmount,
-        lifes
-    );
+    impl->lifesAmount.setNumber(lifes);
+
+    impl->window.invalidate();
 }
 
 /**
  *
  */
-void GameDashboard::decrementLifes() const &
+void GameDashboard::decrementLifes() const & noexcept
 {
     auto& lifes = impl->lifes;
     lifes -= 1;
 
-    updateSfmlTextByNumericValue(
-        impl->lifesAmount,
-        lifes
-    );
+    impl->lifesAmount.setNumber(lifes);
+
+    impl->window.invalidate();
 }
 
 /**
  *
  */
-void GameDashboard::increaseWatchingTime() const &
+void GameDashboard::increaseWatchingTime() const & noexcept
 {
     auto& watchingTime = impl->watchingTime;
     watchingTime += WATCHING_TIME_UPDATE_STEP;
 
-    updateSfmlTextByNumericValue(
-        impl->time,
-        watchingTime
-    );
+    impl->time.setNumber(watchingTime);
+
+    impl->window.invalidate();
 }
 
 /**
  *
  */
-void GameDashboard::decreaseWatchingTime() const &
+void GameDashboard::decreaseWatchingTime() const & noexcept
 {
     auto& watchingTime = impl->watchingTime;
     watchingTime -= WATCHING_TIME_UPDATE_STEP;
 
-    updateSfmlTextByNumericValue(
-        impl->time,
-        watchingTime
-    );
+    impl->time.setNumber(watchingTime);
+
+    impl->window.invalidate();
 }
 
 /**
  *
  */
 void GameDashboard::updateCurrentFloor(const unsigned short& floorIndex)
-    const &
+    const & noexcept
 {
     constexpr unsigned short DISPLAYED_FLOOR_OFFSET {1};
-    updateSfmlTextByNumericValue(
-        impl->floor,
-        floorIndex + DISPLAYED_FLOOR_OFFSET
-    );
+    impl->floor.setNumber(floorIndex + DISPLAYED_FLOOR_OFFSET);
+
+    impl->window.invalidate();
 }
 
 /**
@@ -372,24 +380,13 @@ void GameDashboard::updateCurrentFloor(const unsigned short& floorIndex)
  */
 const float GameDashboard::getHorizontalPositionMinusWidth(
     const float& rightSideHorizontalPosition,
-    const sf::Text& sfmlSurface
-) const &
+    const widgets::DigitsText& digits
+) const & noexcept
 {
     constexpr float MINIMUM_PAGGING {15.f};
-    return rightSideHorizontalPosition - sfmlSurface.getLocalBounds().width -
+    return rightSideHorizontalPosition - digits.getWidth() -
         MINIMUM_PAGGING;
 }
 
-/**
- *
- */
-void GameDashboard::updateSfmlTextByNumericValue(
-    sf::Text& sfmlText,
-    const unsigned short& numericValue
-) const &
-{
-    sfmlText.setString(std::to_string(numericValue));
-}
-
 }
 }
@@ -27,9 +27,9 @@
 #include "Context.hpp"
 #include "window.hpp"
 #include "ColorsManager.hpp"
+#include "ProfiledWindow.hpp"
 
 #include <SFML/Graphics/RectangleShape.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
 
 namespace memoris
 {
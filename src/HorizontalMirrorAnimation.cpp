@@ -27,12 +27,13 @@
 #include "SoundsManager.hpp"
 #include "ShapesManager.hpp"
 #include "Level.hpp"
-#include "Cell.hpp"
 #include "dimensions.hpp"
+#include "floor_permutations.hpp"
+#include "game_state.hpp"
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
 
 #include <SFML/Graphics/RectangleShape.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
 
 namespace memoris
 {
@@ -60,19 +61,31 @@ HorizontalMirrorAnimation::HorizontalMirrorAnimation(
  */
 void HorizontalMirrorAnimation::renderAnimation() &
 {
-    const auto& context = getContext();
-
-    constexpr sf::Uint32 ANIMATION_STEPS_INTERVAL {50};
-    if (
-        context.getClockMillisecondsTime() -
-        getAnimationLastUpdateTime() < ANIMATION_STEPS_INTERVAL
+    for (
+        auto steps = getElapsedAnimationSteps();
+        steps != 0 and not isFinished();
+        steps -= 1
     )
     {
-        displayLevelAndHorizontalSeparator();
+        startTransparencyStep();
 
-        return;
+        playNextAnimationStep();
+
+        incrementAnimationStep();
     }
 
+    interpolateTransparency();
+
+    displayLevelAndHorizontalSeparator();
+}
+
+/**
+ *
+ */
+void HorizontalMirrorAnimation::playNextAnimationStep() const &
+{
+    const auto& context = getContext();
+
     const auto animationSteps = getAnimationSteps();
 
     if (animationSteps == 0)
@@ -135,10 +148,6 @@ void HorizontalMirrorAnimation::renderAnimation() &
 
         endsAnimation();
     }
-
-    displayLevelAndHorizontalSeparator();
-
-    incrementAnimationStep();
 }
 
 /**
@@ -146,92 +155,20 @@ void HorizontalMirrorAnimation::renderAnimation() &
  */
 void HorizontalMirrorAnimation::invertSides() const &
 {
-    const auto& level = getLevel();
-
-    const unsigned short previousPlayerCell = level->getPlayerCellIndex();
-
-    unsigned short line {0};
-    unsigned short floor {0};
+    const auto& permutation = game::getFloorPermutation(
+        game::Transformation::HorizontalMirror
+    );
 
     for (
-        unsigned short index {0};
-        index < dimensions::CELLS_PER_LEVEL;
-        index += 1
+        unsigned short floor {0};
+        floor < game::FLOORS_PER_LEVEL;
+        floor += 1
     )
     {
-        using namespace dimensions;
-
-        if (
-            index >= TOP_SIDE_LAST_CELL_INDEX + (CELLS_PER_FLOOR * floor) and
-            index < CELLS_PER_FLOOR * (floor + 1)
-        )
-        {
-            if ((index + 1) % CELLS_PER_FLOOR == 0)
-            {
-                floor += 1;
-                line = 0;
-            }
-
-            continue;
-        }
-
-        const char type = level->getCells()[index]->getType();
-        const bool visible = level->getCells()[index]->isVisible();
-        const unsigned short invertedIndex =
-            findInvertedIndex(
-                floor,
-                line,
-                index
-            );
-
-        level->getCells()[index]->setType(
-            level->getCells()[invertedIndex]->getType()
-        );
-
-        constexpr sf::Uint8 NOT_DISPLAYED_TRANSPARENCY {0};
-
-        showOrHideCell(
-            index,
-            level->getCells()[invertedIndex]->isVisible(),
-            NOT_DISPLAYED_TRANSPARENCY
-        );
-
-        level->getCells()[invertedIndex]->setType(type);
-
-        showOrHideCell(
-            invertedIndex,
-            visible,
-            NOT_DISPLAYED_TRANSPARENCY
+        permuteFloorCells(
+            floor,
+            permutation
         );
-
-        if (previousPlayerCell == index)
-        {
-            setUpdatedPlayerIndex(
-                findInvertedIndex(
-                    floor,
-                    line,
-                    index
-                )
-            );
-        } else if (
-            previousPlayerCell ==
-                findInvertedIndex(
-                    floor,
-                    line,
-                    index
-                )
-        )
-        {
-            setUpdatedPlayerIndex(index);
-        }
-
-        if (
-            index != 0 and
-            (index + 1) % CELLS_PER_LINE == 0
-        )
-        {
-            line += 1;
-        }
     }
 }
 
@@ -292,25 +229,5 @@ void HorizontalMirrorAnimation::displayLevelAndHorizontalSeparator() const &
     );
 }
 
-/**
- *
- */
-const unsigned short HorizontalMirrorAnimation::findInvertedIndex(
-    const unsigned short& floor,
-    const unsigned short& line,
-    const unsigned short& index
-) const & noexcept
-{
-    using namespace dimensions;
-    const unsigned short offset = 240 + (CELLS_PER_FLOOR * floor);
-    constexpr unsigned short LINE_CELLS_FACTOR {32};
-
-    /* this calculation can work with negative value, but at the end,
-       the result should always be more than 0 to prevent seg fault */
-    return offset - LINE_CELLS_FACTOR * line + (
-        index - CELLS_PER_FLOOR * floor
-    );
-}
-
 }
 }
@@ -27,8 +27,8 @@
 #include "FontsManager.hpp"
 #include "ColorsManager.hpp"
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
 
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Window/Event.hpp>
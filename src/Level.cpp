@@ -26,14 +26,21 @@
 #include "Level.hpp"
 
 #include "cells.hpp"
-#include "Cell.hpp"
 #include "dimensions.hpp"
+#include "CellsTexturesManager.hpp"
+#include "ColorsManager.hpp"
+#include "Context.hpp"
+#include "level_files.hpp"
+#include "floor_permutations.hpp"
+#include "ProfiledWindow.hpp"
+#include "cells_grid.hpp"
+#include "EditorJournal.hpp"
 
-#include <SFML/Window/Keyboard.hpp>
-#include <SFML/Window/Event.hpp>
 #include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
 
-#include <fstream>
+#include <array>
+#include <algorithm>
 
 namespace memoris
 {
@@ -42,6 +49,16 @@ namespace entities
 
 constexpr unsigned short CELLS_PER_FLOOR {256};
 constexpr unsigned short CELLS_PER_LINE {16};
+constexpr unsigned short FLOORS_PER_LEVEL {10};
+constexpr unsigned short VERTICES_PER_CELL {4};
+
+constexpr float HORIZONTAL_POSITION_ORIGIN {400.f};
+constexpr float VERTICAL_POSITION_ORIGIN {98.f};
+constexpr float CELL_DIMENSIONS {50.f};
+constexpr float CELL_PICTURE_DIMENSIONS {49.f};
+
+constexpr float FLOOR_CENTER_HORIZONTAL_POSITION {800.f};
+constexpr float FLOOR_CENTER_VERTICAL_POSITION {498.f};
 
 class Level::Impl
 {
@@ -51,15 +68,27 @@ public:
     Impl(const utils::Context& context) :
         context(context)
     {
+        const auto white = context.getColorsManager().getColorWhiteCopy();
+
+        /* every cell of a new level is visible and fully opaque,
+           the cells types are set by the level constructors */
+        visibilities.fill(true);
+        colors.fill(white);
     }
 
-    std::vector<std::unique_ptr<Cell>> cells;
+    /* the level is stored as a set of flat arrays indexed by the cell index
+       (structure of arrays); a full level pass is a linear scan over
+       a few kilobytes instead of thousands of pointers dereferences;
+       the rendering data is derived from these arrays */
+    std::array<char, dimensions::CELLS_PER_LEVEL> types;
+    std::array<bool, dimensions::CELLS_PER_LEVEL> visibilities;
+    std::array<sf::Color, dimensions::CELLS_PER_LEVEL> colors;
 
     unsigned short playerIndex {0};
     unsigned short starsAmount {0};
     unsigned short minutes {0};
     unsigned short seconds {0};
-    unsigned short lastPlayableCell {0};
+    unsigned short lastPlayableFloor {0};
 
     bool animateFloorTransition {false};
 
@@ -67,6 +96,11 @@ public:
 
     std::unique_ptr<sf::Transform> transform {nullptr};
 
+    /* one array of quads per floor, textured from the cells atlas;
+       the vertices are updated in place everytime a cell changes,
+       so displaying a floor is one unique draw call */
+    std::array<sf::VertexArray, FLOORS_PER_LEVEL> floors;
+
     const utils::Context& context;
 };
 
@@ -76,27 +110,9 @@ public:
 Level::Level(const utils::Context& context) :
     impl(std::make_unique<Impl>(context))
 {
-    unsigned short row {0}, column {0};
-
-    for(
-        unsigned short index {0};
-        index < dimensions::CELLS_PER_LEVEL;
-        index += 1
-    )
-    {
-        std::unique_ptr<Cell> cell = getCellByType(
-            static_cast<float>(column),
-            static_cast<float>(row),
-            cells::WALL_CELL
-        );
+    impl->types.fill(cells::WALL_CELL);
 
-        incrementRowAndColumnIndexes(
-            row,
-            column
-        );
-
-        impl->cells.push_back(std::move(cell));
-    }
+    initializeFloorsVertices();
 }
 
 /**
@@ -104,78 +120,21 @@ Level::Level(const utils::Context& context) :
  */
 Level::Level(
     const utils::Context& context,
-    const std::string& filePath
+    const levels::LevelData& data
 ) :
     impl(std::make_unique<Impl>(context))
 {
-    /* FIXME: #1358 std::ifstream should not be used within the constructor */
+    /* the level file has already been loaded and parsed (or directly mapped
+       for the binary format), the constructor only copies the data */
 
-    std::ifstream file(filePath);
-
-    if (!file.is_open())
-    {
-        /* TODO: #561 - check PlayingSerieManager.cpp for details */
-        throw std::invalid_argument("Cannot open the given level file");
-    }
-
-    /* FIXME: if the minutes/seconds are not specified or partially specified,
-       the behavior is unmanaged */
-    std::string min, sec;
-    getline(file, min, '\n');
-    getline(file, sec, '\n');
-
-    impl->minutes = static_cast<unsigned short>(std::stoi(min));
-    impl->seconds = static_cast<unsigned short>(std::stoi(sec));
-
-    unsigned short row {0}, column {0};
-
-    for(
-        unsigned short index {0};
-        index < dimensions::CELLS_PER_LEVEL;
-        index += 1
-    )
-    {
-        char cellType = cells::EMPTY_CELL;
-
-        if (!file.eof())
-        {
-            cellType = file.get();
-        }
-
-        std::unique_ptr<Cell> cell = getCellByType(
-            static_cast<float>(column),
-            static_cast<float>(row),
-            cellType
-        );
-
-        incrementRowAndColumnIndexes(
-            row,
-            column
-        );
-
-        switch(cellType)
-        {
-        case cells::DEPARTURE_CELL:
-        {
-            impl->playerIndex = index;
-
-            break;
-        }
-        case cells::STAR_CELL:
-        {
-            impl->starsAmount += 1;
+    impl->types = data.cells;
+    impl->minutes = data.minutes;
+    impl->seconds = data.seconds;
+    impl->starsAmount = data.starsAmount;
+    impl->playerIndex = data.departureIndex;
+    impl->lastPlayableFloor = data.lastPlayableFloor;
 
-            break;
-        }
-        }
-
-        if (cellType != cells::WALL_CELL)
-        {
-            impl->lastPlayableCell = index;
-        }
-
-        impl->cells.push_back(std::move(cell));
-    }
+    initializeFloorsVertices();
 }
 
 /**
@@ -188,182 +147,101 @@ Level::~Level() = default;
  */
 const unsigned short Level::getLastPlayableFloor() const & noexcept
 {
-    return impl->lastPlayableCell / CELLS_PER_FLOOR;
+    return impl->lastPlayableFloor;
 }
 
 /**
  *
  */
-void Level::showPlayerCell() const &
+void Level::showPlayerCell() const & noexcept
 {
-    (*impl->cells[impl->playerIndex]).show(impl->context);
+    showCell(impl->playerIndex);
 }
 
 /**
  *
  */
-void Level::hideAllCells() const &
+void Level::hideAllCells() const & noexcept
 {
-    const auto& context = impl->context;
+    impl->visibilities.fill(false);
 
-    std::for_each(
-        impl->cells.begin(),
-        impl->cells.end(),
-        [&context](const std::unique_ptr<Cell>& cell)
-    {
-        cell->hide(context);
-    }
-    );
+    updateAllCellsVertices();
 }
 
 /**
  *
  */
-void Level::makeTopMovement() const & noexcept
+const std::pair<float, float> Level::getPlayerPosition() const & noexcept
 {
-    const short TOP_MOVE {-16};
-    impl->playerIndex += TOP_MOVE;
+    return getCellPosition(impl->playerIndex);
 }
 
 /**
  *
  */
-void Level::makeBottomMovement() const & noexcept
+void Level::display(const unsigned short& floor) const &
 {
-    const short BOTTOM_MOVE {16};
-    impl->playerIndex += BOTTOM_MOVE;
-}
+    const auto& context = impl->context;
+    const auto& transform = impl->transform;
 
-/**
- *
- */
-void Level::makeLeftMovement() const & noexcept
-{
-    const short LEFT_MOVE {-1};
-    impl->playerIndex += LEFT_MOVE;
-}
+    sf::RenderStates states(
+        &context.getCellsTexturesManager().getAtlasTexture()
+    );
 
-/**
- *
- */
-void Level::makeRightMovement() const & noexcept
-{
-    const short RIGHT_MOVE {1};
-    impl->playerIndex += RIGHT_MOVE;
-}
+    if (transform != nullptr)
+    {
+        states.transform = *transform;
+    }
 
-/**
- *
- */
-const std::pair<float, float> Level::getPlayerPosition() const & noexcept
-{
-    return (*impl->cells[impl->playerIndex]).getPosition();
+    context.getSfmlWindow().draw(
+        impl->floors[floor],
+        states
+    );
 }
 
 /**
  *
  */
-const bool Level::isPlayerMovementAllowed(
-    const sf::Event& event,
-    const unsigned short& floor
+void Level::display(
+    const unsigned short& floor,
+    const float& degrees
 ) const &
 {
-    const auto& playerIndex = impl->playerIndex;
-    unsigned short expectedIndex = playerIndex;
-    short movement {0};
-
-    switch(event.key.code)
-    {
-    case sf::Keyboard::Up:
-    {
-        constexpr float TOP_MOVE {-16};
-        expectedIndex += TOP_MOVE;
-        movement = TOP_MOVE;
-
-        break;
-    }
-    case sf::Keyboard::Down:
-    {
-        constexpr float BOTTOM_MOVE {16};
-        expectedIndex += BOTTOM_MOVE;
-        movement = BOTTOM_MOVE;
-
-        break;
-    }
-    case sf::Keyboard::Left:
-    {
-        constexpr float LEFT_MOVE {-1};
-        expectedIndex += LEFT_MOVE;
-        movement = LEFT_MOVE;
-
-        break;
-    }
-    default:
-    {
-        constexpr float RIGHT_MOVE {1};
-        expectedIndex += RIGHT_MOVE;
-        movement = RIGHT_MOVE;
-
-        break;
-    }
-    }
+    const auto& context = impl->context;
+    const auto& transform = impl->transform;
 
-    if (
-        expectedIndex < CELLS_PER_FLOOR * floor or
-        expectedIndex >= CELLS_PER_FLOOR * (floor + 1) or
-        (
-            expectedIndex % CELLS_PER_LINE == 0 and
-            movement == 1
-        ) or
-        (
-            playerIndex % CELLS_PER_LINE == 0 and
-            movement == -1
-        )
-    )
-    {
-        return false;
-    }
+    sf::RenderStates states(
+        &context.getCellsTexturesManager().getAtlasTexture()
+    );
 
-    const auto& nextCell = *impl->cells[expectedIndex];
-    if(nextCell.getType() == cells::WALL_CELL)
+    if (transform != nullptr)
     {
-        nextCell.show(impl->context);
-
-        return false;
+        states.transform = *transform;
     }
 
-    return true;
-}
+    states.transform.rotate(
+        degrees,
+        FLOOR_CENTER_HORIZONTAL_POSITION,
+        FLOOR_CENTER_VERTICAL_POSITION
+    );
 
-/**
- *
- */
-void Level::display(const unsigned short& floor) const &
-{
-    constexpr unsigned short CELLS_PER_FLOOR {256};
-    const unsigned short firstCellIndex = floor * CELLS_PER_FLOOR;
-    const unsigned short lastCellIndex = (floor + 1) * CELLS_PER_FLOOR;
+    auto& window = context.getSfmlWindow();
+    window.draw(
+        impl->floors[floor],
+        states
+    );
 
-    for(
-        unsigned short index = firstCellIndex;
-        index < lastCellIndex;
-        index += 1
-    )
-    {
-        (*impl->cells[index]).display(
-            impl->context,
-            impl->transform
-        );
-    }
+    /* the angle changes every frame, so the next frame is drawn too */
+    window.invalidate();
 }
 
 /**
  *
  */
-void Level::setPlayerCellTransparency(const sf::Uint8& alpha) const &
+void Level::setPlayerCellTransparency(const sf::Uint8& alpha) const & noexcept
 {
-    (*impl->cells[impl->playerIndex]).setCellColorTransparency(
-        impl->context,
+    setCellColorTransparency(
+        impl->playerIndex,
         alpha
     );
 }
@@ -371,18 +249,18 @@ void Level::setPlayerCellTransparency(const sf::Uint8& alpha) const &
 /**
  *
  */
-const char& Level::getPlayerCellType() const &
+const char& Level::getPlayerCellType() const & noexcept
 {
-    return (*impl->cells[impl->playerIndex]).getType();
+    return impl->types[impl->playerIndex];
 }
 
 /**
  *
  */
-void Level::emptyPlayerCell() const &
+void Level::emptyPlayerCell() const & noexcept
 {
-    (*impl->cells[impl->playerIndex]).empty();
-    (*impl->cells[impl->playerIndex]).show(impl->context);
+    impl->types[impl->playerIndex] = cells::EMPTY_CELL;
+    showCell(impl->playerIndex);
 }
 
 /**
@@ -439,10 +317,10 @@ void Level::setPlayerCellIndex(const unsigned short& index) const & noexcept
 void Level::setCellsTransparency(
     const float& transparency,
     const unsigned short& floor
-) const &
+) const & noexcept
 {
-    const unsigned short firstCellIndex = floor * 256;
-    const unsigned short lastCellIndex = firstCellIndex + 256;
+    const unsigned short firstCellIndex = floor * CELLS_PER_FLOOR;
+    const unsigned short lastCellIndex = firstCellIndex + CELLS_PER_FLOOR;
 
     for (
         unsigned short index = firstCellIndex;
@@ -450,8 +328,8 @@ void Level::setCellsTransparency(
         index += 1
     )
     {
-        impl->cells[index]->setCellColorTransparency(
-            impl->context,
+        setCellColorTransparency(
+            index,
             transparency
         );
     }
@@ -460,9 +338,136 @@ void Level::setCellsTransparency(
 /**
  *
  */
-const std::vector<std::unique_ptr<Cell>>& Level::getCells() const & noexcept
+const char& Level::getCellType(const unsigned short& index) const & noexcept
+{
+    return impl->types[index];
+}
+
+/**
+ *
+ */
+void Level::setCellType(
+    const unsigned short& index,
+    const char& type
+) const & noexcept
+{
+    impl->types[index] = type;
+
+    updateCellTextureCoordinates(index);
+}
+
+/**
+ *
+ */
+const bool Level::isCellVisible(const unsigned short& index) const & noexcept
+{
+    return impl->visibilities[index];
+}
+
+/**
+ *
+ */
+void Level::showCell(
+    const unsigned short& index,
+    const sf::Uint8& transparency
+) const & noexcept
+{
+    impl->visibilities[index] = true;
+
+    updateCellTextureCoordinates(index);
+
+    setCellColorTransparency(
+        index,
+        transparency
+    );
+}
+
+/**
+ *
+ */
+void Level::hideCell(const unsigned short& index) const & noexcept
+{
+    impl->visibilities[index] = false;
+
+    updateCellTextureCoordinates(index);
+}
+
+/**
+ *
+ */
+void Level::setCellColorTransparency(
+    const unsigned short& index,
+    const sf::Uint8& alpha
+) const & noexcept
+{
+    sf::Color cellColor = impl->context.getColorsManager().getColorWhiteCopy();
+    cellColor.a = alpha;
+
+    impl->colors[index] = cellColor;
+
+    updateCellColor(index);
+}
+
+/**
+ *
+ */
+void Level::permuteFloorCells(
+    const unsigned short& floor,
+    const game::FloorPermutation& permutation
+) const & noexcept
+{
+    const unsigned short firstIndex = floor * CELLS_PER_FLOOR;
+
+    /* the floor is copied on the stack, then every cell is written
+       once at its destination */
+    std::array<char, CELLS_PER_FLOOR> types;
+    std::array<bool, CELLS_PER_FLOOR> visibilities;
+    std::array<sf::Color, CELLS_PER_FLOOR> colors;
+
+    std::copy_n(
+        impl->types.cbegin() + firstIndex,
+        CELLS_PER_FLOOR,
+        types.begin()
+    );
+    std::copy_n(
+        impl->visibilities.cbegin() + firstIndex,
+        CELLS_PER_FLOOR,
+        visibilities.begin()
+    );
+    std::copy_n(
+        impl->colors.cbegin() + firstIndex,
+        CELLS_PER_FLOOR,
+        colors.begin()
+    );
+
+    for (
+        unsigned short index {0};
+        index < CELLS_PER_FLOOR;
+        index += 1
+    )
+    {
+        const unsigned short destination = firstIndex + permutation[index];
+
+        impl->types[destination] = types[index];
+        impl->visibilities[destination] = visibilities[index];
+        impl->colors[destination] = colors[index];
+
+        updateCellTextureCoordinates(destination);
+        updateCellColor(destination);
+    }
+}
+
+/**
+ *
+ */
+void Level::setCellColor(
+    const unsigned short& index,
+    const sf::Color& color
+) const & noexcept
 {
-    return impl->cells;
+    impl->colors[index] = color;
+
+    updateCellColor(index);
 }
 
 /**
@@ -471,6 +476,8 @@ const std::vector<std::unique_ptr<Cell>>& Level::getCells() const & noexcept
 void Level::createTransform() const &
 {
     impl->transform.reset(new sf::Transform);
+
+    impl->context.getSfmlWindow().invalidate();
 }
 
 /**
@@ -479,6 +486,8 @@ void Level::createTransform() const &
 void Level::deleteTransform() const & noexcept
 {
     impl->transform.reset();
+
+    impl->context.getSfmlWindow().invalidate();
 }
 
 /**
@@ -486,13 +495,13 @@ void Level::deleteTransform() const & noexcept
  */
 void Level::rotateAllCells(const short& degrees) const &
 {
-    constexpr float FLOOR_CENTER_HORIZONTAL_POSITION {800.f};
-    constexpr float FLOOR_CENTER_VERTICAL_POSITION {498.f};
     impl->transform->rotate(
         degrees,
         FLOOR_CENTER_HORIZONTAL_POSITION,
         FLOOR_CENTER_VERTICAL_POSITION
     );
+
+    impl->context.getSfmlWindow().invalidate();
 }
 
 /**
@@ -500,142 +509,124 @@ void Level::rotateAllCells(const short& degrees) const &
  */
 bool Level::updateSelectedCellType(
     const unsigned short& floor,
-    const char& type
+    const char& type,
+    const utils::EditorJournal& journal
 ) const &
 {
-    const unsigned short firstCellIndex = floor * CELLS_PER_FLOOR;
-    const unsigned short lastCellIndex = (floor + 1) * CELLS_PER_FLOOR;
+    const short hoverIndex = getMouseHoverCellIndex(floor);
+
+    if (hoverIndex == utils::NO_GRID_CELL)
+    {
+        return false;
+    }
 
-    auto updated = false;
+    const unsigned short index = hoverIndex;
 
-    const auto& cells = impl->cells;
+    auto& types = impl->types;
 
-    for(
-        auto iterator = cells.cbegin() + firstCellIndex;
-        iterator != cells.cbegin() + lastCellIndex;
-        iterator += 1
+    const auto cellType = types[index];
+
+    /* every change is recorded, including the coupled stairs cells,
+       so the whole edition can be undone */
+    const auto editCell = [this, &types, &journal](
+        const unsigned short& cellIndex,
+        const char& editedType
     )
     {
-        const auto& cell = **iterator;
-
-        if (not cell.isMouseHover())
-        {
-            continue;
-        }
-
-        const auto index = std::distance(
-            cells.cbegin(),
-            iterator
+        journal.recordCellChange(
+            cellIndex,
+            types[cellIndex],
+            editedType
         );
 
-        if (
-            cell.getType() == type or
+        types[cellIndex] = editedType;
+        showCell(cellIndex);
+    };
+
+    if (
+        cellType == type or
+        (
             (
-                (
-                    type == cells::STAIRS_UP_CELL or
-                    type == cells::ELEVATOR_UP_CELL
-                ) and
-                index >= dimensions::CELLS_PER_LEVEL - CELLS_PER_FLOOR
-            ) or
+                type == cells::STAIRS_UP_CELL or
+                type == cells::ELEVATOR_UP_CELL
+            ) and
+            index >= dimensions::CELLS_PER_LEVEL - CELLS_PER_FLOOR
+        ) or
+        (
             (
-                (
-                    type == cells::STAIRS_DOWN_CELL or
-                    type == cells::ELEVATOR_DOWN_CELL
-                ) and
-                index < CELLS_PER_FLOOR
-            )
+                type == cells::STAIRS_DOWN_CELL or
+                type == cells::ELEVATOR_DOWN_CELL
+            ) and
+            index < CELLS_PER_FLOOR
         )
-        {
-            break;
-        }
-
-        const auto& context = impl->context;
-        const auto stairsDownIndex = index + CELLS_PER_FLOOR;
-        const auto stairsUpIndex = index - CELLS_PER_FLOOR;
+    )
+    {
+        return false;
+    }
 
-        if (type == cells::DEPARTURE_CELL)
-        {
-            impl->playerIndex = index;
-        }
-        else if (
-            type == cells::EMPTY_CELL and
-            cell.getType() == cells::STAIRS_UP_CELL
-        )
-        {
-            const auto& nextFloorCell = cells[stairsDownIndex];
-            nextFloorCell->setType(cells::EMPTY_CELL);
-            nextFloorCell->show(context);
-        }
-        else if (
-            type == cells::EMPTY_CELL and
-            cell.getType() == cells::STAIRS_DOWN_CELL
-        )
-        {
-            const auto& previousFloorCell = cells[stairsUpIndex];
-            previousFloorCell->setType(cells::EMPTY_CELL);
-            previousFloorCell->show(context);
-        }
+    const unsigned short stairsDownIndex = index + CELLS_PER_FLOOR;
+    const unsigned short stairsUpIndex = index - CELLS_PER_FLOOR;
 
-        cell.setType(type);
-        cell.show(context);
+    if (type == cells::DEPARTURE_CELL)
+    {
+        impl->playerIndex = index;
+    }
+    else if (
+        type == cells::EMPTY_CELL and
+        cellType == cells::STAIRS_UP_CELL
+    )
+    {
+        editCell(stairsDownIndex, cells::EMPTY_CELL);
+    }
+    else if (
+        type == cells::EMPTY_CELL and
+        cellType == cells::STAIRS_DOWN_CELL
+    )
+    {
+        editCell(stairsUpIndex, cells::EMPTY_CELL);
+    }
 
-        auto& nextFloorCell = cells[stairsDownIndex];
-        if (
-            type == cells::STAIRS_UP_CELL and
-            stairsDownIndex <= dimensions::CELLS_PER_LEVEL
-        )
-        {
-            nextFloorCell->setType(cells::STAIRS_DOWN_CELL);
-            nextFloorCell->show(context);
-        }
+    editCell(index, type);
 
-        auto& previousFloorCell = cells[stairsUpIndex];
-        if (
-            type == cells::STAIRS_DOWN_CELL and
-            stairsUpIndex >= 0
-        )
-        {
-            previousFloorCell->setType(cells::STAIRS_UP_CELL);
-            previousFloorCell->show(context);
-        }
+    /* stairs up cells cannot be put on the last floor and stairs
+       down cells cannot be put on the first floor (checked above),
+       so the coupled cell index is always into the level */
 
-        updated = true;
+    if (type == cells::STAIRS_UP_CELL)
+    {
+        editCell(stairsDownIndex, cells::STAIRS_DOWN_CELL);
+    }
 
-        break;
+    if (type == cells::STAIRS_DOWN_CELL)
+    {
+        editCell(stairsUpIndex, cells::STAIRS_UP_CELL);
     }
 
-    return updated;
+    return true;
 }
 
 /**
  *
  */
-void Level::allCellsAsWalls() const &
+void Level::allCellsAsWalls() const & noexcept
 {
-    const auto& cells = impl->cells;
+    impl->types.fill(cells::WALL_CELL);
 
-    std::for_each(
-        cells.begin(),
-        cells.end(),
-        [this](const auto& cell)
-    {
-        cell->setType(cells::WALL_CELL);
-        cell->show(impl->context);
-    }
-    );
+    /* also refreshes all the vertices */
+    showAllCells();
 }
 
 /**
  *
  */
-void Level::showAllCells() const &
+void Level::showAllCells() const & noexcept
 {
-    const auto& cells = impl->cells;
+    const auto white = impl->context.getColorsManager().getColorWhiteCopy();
 
-    for (const auto& cell : cells)
-    {
-        cell->show(impl->context);
-    }
+    impl->visibilities.fill(true);
+    impl->colors.fill(white);
+
+    updateAllCellsVertices();
 }
 
 /**
@@ -643,29 +634,25 @@ void Level::showAllCells() const &
  */
 const bool Level::hasOneDepartureAndOneArrival() const & noexcept
 {
-    unsigned short departureCellsAmount {0};
-    unsigned short arrivalCellsAmount {0};
-
     /* this method browses the whole cells list of the level;
        we could have created two booleans indicating if the departure cell
        and the arrival cell exists; however this feature is only required
        for the level editor, so we would have created two useless attributes
        in case of the level is used into the game (and not into the editor) */
 
-    const auto& cells = impl->cells;
-    for (const auto& cell : cells)
-    {
-        const auto& type = cell->getType();
+    const auto& types = impl->types;
 
-        if (type == cells::DEPARTURE_CELL)
-        {
-            departureCellsAmount += 1;
-        }
-        else if (type == cells::ARRIVAL_CELL)
-        {
-            arrivalCellsAmount += 1;
-        }
-    }
+    const auto departureCellsAmount = std::count(
+        types.cbegin(),
+        types.cend(),
+        cells::DEPARTURE_CELL
+    );
+
+    const auto arrivalCellsAmount = std::count(
+        types.cbegin(),
+        types.cend(),
+        cells::ARRIVAL_CELL
+    );
 
     return (
         departureCellsAmount == 1 and
@@ -685,25 +672,19 @@ void Level::initializeEditedLevel() const & noexcept
     impl->seconds = EDITED_LEVEL_TIME;
     impl->minutes = EDITED_LEVEL_TIME;
 
-    const auto& cells = impl->cells;
-
-    using CellsIterator =
-        std::vector<std::unique_ptr<entities::Cell>>::const_iterator;
+    const auto& types = impl->types;
 
     for (
-        CellsIterator iterator = cells.cbegin();
-        iterator != cells.cend();
-        ++iterator
+        unsigned short index {0};
+        index < dimensions::CELLS_PER_LEVEL;
+        index += 1
     )
     {
-        switch((*iterator)->getType())
+        switch(types[index])
         {
         case cells::DEPARTURE_CELL:
         {
-            impl->playerIndex = std::distance(
-                cells.cbegin(),
-                iterator
-            );
+            impl->playerIndex = index;
 
             break;
         }
@@ -726,15 +707,12 @@ void Level::initializeEditedLevel() const & noexcept
  */
 const std::vector<char> Level::getCharactersList() const & noexcept
 {
-    std::vector<char> characters;
+    const auto& types = impl->types;
 
-    const auto& cells = impl->cells;
-    for (const auto& cell : cells)
-    {
-        characters.push_back(cell->getType());
-    }
-
-    return characters;
+    return std::vector<char>(
+        types.cbegin(),
+        types.cend()
+    );
 }
 
 /**
@@ -743,18 +721,16 @@ const std::vector<char> Level::getCharactersList() const & noexcept
 void Level::setCellsFromCharactersList(const std::vector<char>& characters)
     const &
 {
-    unsigned short index {0};
-
-    const auto& cells = impl->cells;
-    std::for_each(
+    std::copy(
         characters.cbegin(),
-        characters.cend(),
-        [&index, &cells](const char& character)
-        {
-            cells[index]->setType(character);
-            index += 1;
-        }
+        characters.cbegin() + std::min(
+            characters.size(),
+            impl->types.size()
+        ),
+        impl->types.begin()
     );
+
+    updateAllCellsVertices();
 }
 
 /**
@@ -776,45 +752,155 @@ void Level::setMinutes(const unsigned short& minutes) const & noexcept
 /**
  *
  */
-void Level::incrementRowAndColumnIndexes(
-    unsigned short& row,
-    unsigned short& column
+const std::pair<float, float> Level::getCellPosition(
+    const unsigned short& index
 ) const & noexcept
 {
-    column += 1;
-    if (column % CELLS_PER_LINE == 0)
+    const unsigned short floorIndex = index % CELLS_PER_FLOOR;
+
+    return std::make_pair(
+        HORIZONTAL_POSITION_ORIGIN +
+            CELL_DIMENSIONS * (floorIndex % CELLS_PER_LINE),
+        VERTICAL_POSITION_ORIGIN +
+            CELL_DIMENSIONS * (floorIndex / CELLS_PER_LINE)
+    );
+}
+
+/**
+ *
+ */
+void Level::initializeFloorsVertices() const &
+{
+    constexpr unsigned short VERTICES_PER_FLOOR {
+        CELLS_PER_FLOOR * VERTICES_PER_CELL
+    };
+
+    for (auto& floor : impl->floors)
     {
-        column = 0;
-        row += 1;
+        floor.setPrimitiveType(sf::Quads);
+        floor.resize(VERTICES_PER_FLOOR);
+    }
 
-        if (row % CELLS_PER_LINE == 0)
-        {
-            row = 0;
-        }
+    for(
+        unsigned short index {0};
+        index < dimensions::CELLS_PER_LEVEL;
+        index += 1
+    )
+    {
+        const auto position = getCellPosition(index);
+        const auto& left = position.first;
+        const auto& top = position.second;
+        const auto right = left + CELL_PICTURE_DIMENSIONS;
+        const auto bottom = top + CELL_PICTURE_DIMENSIONS;
+
+        sf::Vertex* quad = getCellVertices(index);
+        quad[0].position = sf::Vector2f(left, top);
+        quad[1].position = sf::Vector2f(right, top);
+        quad[2].position = sf::Vector2f(right, bottom);
+        quad[3].position = sf::Vector2f(left, bottom);
+    }
+
+    updateAllCellsVertices();
+}
+
+/**
+ *
+ */
+void Level::updateAllCellsVertices() const & noexcept
+{
+    for(
+        unsigned short index {0};
+        index < dimensions::CELLS_PER_LEVEL;
+        index += 1
+    )
+    {
+        updateCellTextureCoordinates(index);
+        updateCellColor(index);
     }
 }
 
 /**
  *
  */
-std::unique_ptr<Cell> Level::getCellByType(
-    const float& horizontalPosition,
-    const float& verticalPosition,
-    const char type
-) const &
+void Level::updateCellTextureCoordinates(const unsigned short& index) const &
+    noexcept
 {
-    constexpr float HORIZONTAL_POSITION_ORIGIN {400.f};
-    constexpr float VERTICAL_POSITION_ORIGIN {98.f};
-    constexpr float CELL_DIMENSIONS {50.f};
+    const auto rect =
+        impl->context.getCellsTexturesManager().getAtlasTextureRectByCellType(
+            impl->visibilities[index] ?
+                impl->types[index] :
+                cells::HIDDEN_CELL
+        );
 
-    return std::make_unique<Cell>(
-        impl->context,
-        HORIZONTAL_POSITION_ORIGIN +
-        CELL_DIMENSIONS * horizontalPosition,
-        VERTICAL_POSITION_ORIGIN +
-        CELL_DIMENSIONS * verticalPosition,
-        type
+    const auto left = static_cast<float>(rect.left);
+    const auto top = static_cast<float>(rect.top);
+    const auto right = static_cast<float>(rect.left + rect.width);
+    const auto bottom = static_cast<float>(rect.top + rect.height);
+
+    sf::Vertex* quad = getCellVertices(index);
+    quad[0].texCoords = sf::Vector2f(left, top);
+    quad[1].texCoords = sf::Vector2f(right, top);
+    quad[2].texCoords = sf::Vector2f(right, bottom);
+    quad[3].texCoords = sf::Vector2f(left, bottom);
+
+    /* every cell change goes through this method or the one below,
+       the level invalidates the window by itself */
+    impl->context.getSfmlWindow().invalidate();
+}
+
+/**
+ *
+ */
+void Level::updateCellColor(const unsigned short& index) const & noexcept
+{
+    const auto& color = impl->colors[index];
+
+    sf::Vertex* quad = getCellVertices(index);
+    quad[0].color = color;
+    quad[1].color = color;
+    quad[2].color = color;
+    quad[3].color = color;
+
+    impl->context.getSfmlWindow().invalidate();
+}
+
+/**
+ *
+ */
+sf::Vertex* Level::getCellVertices(const unsigned short& index) const &
+    noexcept
+{
+    return &impl->floors[index / CELLS_PER_FLOOR][
+        (index % CELLS_PER_FLOOR) * VERTICES_PER_CELL
+    ];
+}
+
+/**
+ *
+ */
+const short Level::getMouseHoverCellIndex(const unsigned short& floor)
+    const &
+{
+    constexpr utils::CellsGrid FLOOR_GRID {
+        HORIZONTAL_POSITION_ORIGIN,
+        VERTICAL_POSITION_ORIGIN,
+        CELLS_PER_LINE,
+        CELLS_PER_FLOOR / CELLS_PER_LINE
+    };
+
+    /* the cursor is read once and mapped to a cell arithmetically,
+       instead of testing the bounding box of every cell of the floor */
+    const short index = utils::getGridCellIndex(
+        FLOOR_GRID,
+        utils::getCursorPosition(impl->transform.get())
     );
+
+    if (index == utils::NO_GRID_CELL)
+    {
+        return utils::NO_GRID_CELL;
+    }
+
+    return floor * CELLS_PER_FLOOR + index;
 }
 
 }
@@ -24,9 +24,11 @@
 
 #include "LevelAnimation.hpp"
 
-#include "Cell.hpp"
 #include "Level.hpp"
 #include "Context.hpp"
+#include "FixedTimestep.hpp"
+#include "floor_permutations.hpp"
+#include "dimensions.hpp"
 
 namespace memoris
 {
@@ -41,16 +43,22 @@ public:
     Impl(
         const utils::Context& context,
         const std::shared_ptr<entities::Level>& level,
-        const unsigned short& floor
+        const unsigned short& floor,
+        const sf::Int32& stepsInterval,
+        const FirstStep& firstStep
     ) :
         context(context),
         level(level),
-        floor(floor)
+        floor(floor),
+        steps(
+            stepsInterval,
+            firstStep == FirstStep::Immediate ?
+                context.getClockMillisecondsTime() - stepsInterval :
+                context.getClockMillisecondsTime()
+        )
     {
     }
 
-    sf::Uint32 lastAnimationUpdateTime {0};
-
     unsigned short animationSteps {0};
 
     bool finished {false};
@@ -64,6 +72,10 @@ public:
     const std::shared_ptr<entities::Level> level;
 
     const unsigned short floor;
+
+    /* starts one interval in the past when the first step is played
+       immediately, at the construction time otherwise */
+    utils::FixedTimestep steps;
 };
 
 /**
@@ -72,13 +84,17 @@ public:
 LevelAnimation::LevelAnimation(
     const utils::Context& context,
     const std::shared_ptr<entities::Level>& level,
-    const unsigned short& floor
+    const unsigned short& floor,
+    const sf::Int32& stepsInterval,
+    const FirstStep& firstStep
 ) : 
     impl(
         std::make_unique<Impl>(
             context,
             level,
-            floor
+            floor,
+            stepsInterval,
+            firstStep
         )
     )
 {
@@ -125,64 +141,71 @@ const unsigned short& LevelAnimation::getFloor() const & noexcept
 /**
  *
  */
-void LevelAnimation::showOrHideCell(
-    const unsigned short& index,
-    const bool& visible,
-    const sf::Uint8& transparency
-) const &
+void LevelAnimation::permuteFloorCells(
+    const unsigned short& floor,
+    const game::FloorPermutation& permutation
+) const & noexcept
 {
-    const auto& context = impl->context;
     const auto& level = impl->level;
 
-    if (visible)
+    level->permuteFloorCells(
+        floor,
+        permutation
+    );
+
+    const unsigned short firstIndex = floor * dimensions::CELLS_PER_FLOOR;
+    const auto playerIndex = level->getPlayerCellIndex();
+
+    if (playerIndex / dimensions::CELLS_PER_FLOOR != floor)
     {
-        level->getCells()[index]->show(
-            context,
-            transparency
-        );
+        return;
     }
-    else
+
+    const unsigned short destination =
+        firstIndex + permutation[playerIndex - firstIndex];
+
+    /* the quarters swaps do not move every cell */
+    if (destination != playerIndex)
     {
-        level->getCells()[index]->hide(context);
+        setUpdatedPlayerIndex(destination);
     }
 }
 
 /**
  *
  */
-void LevelAnimation::incrementAnimationStep() const &
+void LevelAnimation::incrementAnimationStep() const & noexcept
 {
     impl->animationSteps += 1;
-
-    impl->lastAnimationUpdateTime = impl->context.getClockMillisecondsTime();
 }
 
 /**
  *
  */
-void LevelAnimation::movePlayer() const &
+const unsigned int LevelAnimation::getElapsedAnimationSteps() const &
 {
-    const auto& level = impl->level;
-
-    level->setPlayerCellIndex(impl->updatedPlayerIndex);
-    level->getCells()[impl->updatedPlayerIndex]->show(impl->context);
+    return impl->steps.consumeSteps(impl->context.getClockMillisecondsTime());
 }
 
 /**
  *
  */
-const sf::Uint32& LevelAnimation::getAnimationLastUpdateTime() const & noexcept
+const float LevelAnimation::getStepInterpolation() const &
 {
-    return impl->lastAnimationUpdateTime;
+    return impl->steps.getInterpolation(
+        impl->context.getClockMillisecondsTime()
+    );
 }
 
 /**
  *
  */
-void LevelAnimation::setAnimationLastUpdateTime(const sf::Uint32& time) const
-    & noexcept
+void LevelAnimation::movePlayer() const &
 {
-    impl->lastAnimationUpdateTime = time;
+    const auto& level = impl->level;
+
+    level->setPlayerCellIndex(impl->updatedPlayerIndex);
+    level->showCell(impl->updatedPlayerIndex);
 }
 
 /**
@@ -32,17 +32,17 @@
 #include "Level.hpp"
 #include "Cursor.hpp"
 #include "EditingLevelManager.hpp"
+#include "EditorJournal.hpp"
 #include "ColorsManager.hpp"
 #include "FontsManager.hpp"
-#include "Cell.hpp"
 #include "MessageForeground.hpp"
 #include "InputTextForeground.hpp"
 #include "PlayingSerieManager.hpp"
 #include "cells.hpp"
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
 
 #include <SFML/Graphics/Text.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Window/Event.hpp>
 
 #include <fstream>
@@ -157,6 +157,7 @@ public:
 
     bool newFile {false};
     bool tested {false};
+    bool painting {false};
 };
 
 /**
@@ -192,6 +193,14 @@ LevelEditorController::LevelEditorController(
  */
 LevelEditorController::~LevelEditorController() = default;
 
+/**
+ *
+ */
+const bool LevelEditorController::isRedrawTracked() const & noexcept
+{
+    return true;
+}
+
 /**
  *
  */
@@ -203,6 +212,16 @@ const ControllerId& LevelEditorController::render() const &
 
     const auto& context = getContext();
 
+    /* the foregrounds input texts have an animated cursor */
+    if (
+        newLevelForeground != nullptr or
+        saveLevelForeground != nullptr or
+        cannotSaveLevelForeground != nullptr
+    )
+    {
+        context.getSfmlWindow().invalidate();
+    }
+
     if (newLevelForeground != nullptr)
     {
         newLevelForeground->render();
@@ -252,7 +271,7 @@ void LevelEditorController::updateLevelNameSurfacePosition() const &
  */
 void LevelEditorController::saveLevelFile(
     const std::string& name,
-    const std::vector<std::unique_ptr<entities::Cell>>& cells
+    const std::vector<char>& cells
 ) const &
 {
     std::ofstream file;
@@ -267,15 +286,10 @@ void LevelEditorController::saveLevelFile(
     cellsStr += std::to_string(impl->level->getMinutes()) + '\n';
     cellsStr += std::to_string(impl->level->getSeconds()) + '\n';
 
-    for (
-        std::vector<std::unique_ptr<entities::Cell>>::const_iterator iterator =
-            cells.cbegin();
-        iterator != cells.cend();
-        ++iterator
-    )
-    {
-        cellsStr += (*iterator)->getType();
-    }
+    cellsStr.append(
+        cells.cbegin(),
+        cells.cend()
+    );
 
     file << cellsStr;
 }
@@ -345,6 +359,8 @@ void LevelEditorController::handleNewLevelForegroundEvents() const &
             {
                 impl->level->allCellsAsWalls();
 
+                getContext().getEditingLevelManager().getJournal().clear();
+
                 changeLevelName(UNNAMED_LEVEL);
 
                 newLevelForeground.reset();
@@ -406,7 +422,7 @@ void LevelEditorController::handleSaveLevelForegroundEvents() const &
 
                 saveLevelFile(
                     levelName,
-                    impl->level->getCells()
+                    impl->level->getCharactersList()
                 );
 
                 changeLevelName(levelName);
@@ -608,12 +624,73 @@ void LevelEditorController::handleControllerEvents() const &
                 impl->selector.selectMouseHoverCell();
             }
 
+            /* the cells painted until the button is released are one
+               unique step of the editor journal */
+            context.getEditingLevelManager().getJournal().beginStroke();
+            impl->painting = true;
+
             if(lastLevelVersionUpdated())
             {
                 markLevelHasToBeSaved();
 
                 tested = false;
             }
+
+            break;
+        }
+        case sf::Event::MouseMoved:
+        {
+            if (not impl->painting)
+            {
+                break;
+            }
+
+            if(lastLevelVersionUpdated())
+            {
+                markLevelHasToBeSaved();
+
+                tested = false;
+            }
+
+            break;
+        }
+        case sf::Event::MouseButtonReleased:
+        {
+            context.getEditingLevelManager().getJournal().endStroke();
+            impl->painting = false;
+
+            break;
+        }
+        case sf::Event::KeyPressed:
+        {
+            if (not event.key.control)
+            {
+                break;
+            }
+
+            const auto& journal =
+                context.getEditingLevelManager().getJournal();
+
+            if (
+                (
+                    (
+                        event.key.code == sf::Keyboard::Z and
+                        journal.undo(*level)
+                    ) or
+                    (
+                        event.key.code == sf::Keyboard::Y and
+                        journal.redo(*level)
+                    )
+                ) and
+                levelNameHasToBeMarked()
+            )
+            {
+                markLevelHasToBeSaved();
+
+                tested = false;
+            }
+
+            break;
         }
         default:
         {
@@ -690,6 +767,7 @@ void LevelEditorController::resetLevel() const &
     levelManager.setLevelName("");
     levelManager.setLevel(nullptr);
     levelManager.refreshLevel();
+    levelManager.getJournal().clear();
 }
 
 /**
@@ -699,7 +777,7 @@ void LevelEditorController::saveLevel(const std::string& levelName) const &
 {
     saveLevelFile(
         levelName,
-        impl->level->getCells()
+        impl->level->getCharactersList()
     );
 
     impl->levelNameSurface.setString(levelName);
@@ -753,13 +831,22 @@ const bool LevelEditorController::lastLevelVersionUpdated() const &
     if(
         not impl->level->updateSelectedCellType(
             impl->floor,
-            impl->selector.getSelectedCellType()
+            impl->selector.getSelectedCellType(),
+            getContext().getEditingLevelManager().getJournal()
         )
     )
     {
         return false;
     }
 
+    return levelNameHasToBeMarked();
+}
+
+/**
+ *
+ */
+const bool LevelEditorController::levelNameHasToBeMarked() const &
+{
     const auto displayedName =
         impl->levelNameSurface.getString().toAnsiString();
 
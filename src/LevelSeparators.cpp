@@ -27,8 +27,8 @@
 #include "Context.hpp"
 #include "ColorsManager.hpp"
 #include "window.hpp"
+#include "ProfiledWindow.hpp"
 
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 
 namespace memoris
@@ -71,7 +71,7 @@ public:
         right.setFillColor(white);
     }
 
-    sf::RenderWindow& window;
+    utils::ProfiledWindow& window;
 
     sf::RectangleShape left;
     sf::RectangleShape right;
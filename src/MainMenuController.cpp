@@ -33,11 +33,11 @@
 #include "window.hpp"
 #include "SoundsManager.hpp"
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
 
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Sprite.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Window/Event.hpp>
 
 namespace memoris
@@ -234,6 +234,17 @@ const ControllerId& MainMenuController::render() const &
     return getNextControllerId();
 }
 
+/**
+ *
+ */
+void MainMenuController::reset() const &
+{
+    AbstractMenuController::reset();
+
+    /* the context clock is restarted at every controller change */
+    impl->titleLastAnimationTime = 0;
+}
+
 /**
  *
  */
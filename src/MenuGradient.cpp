@@ -27,9 +27,9 @@
 #include "Context.hpp"
 #include "window.hpp"
 #include "ColorsManager.hpp"
+#include "ProfiledWindow.hpp"
 
-#include <SFML/Graphics/RectangleShape.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
 
 namespace memoris
 {
@@ -44,30 +44,12 @@ public:
     Impl(const utils::Context& context) :
         context(context)
     {
-        constexpr float BACKGROUND_WIDTH {620.f};
-        menuBackground.setSize(
-            sf::Vector2f(
-                BACKGROUND_WIDTH,
-                window::HEIGHT
-            )
-        );
-
-        constexpr float BACKGROUND_HORIZONTAL_POSITION {480.f};
-        menuBackground.setPosition(
-            BACKGROUND_HORIZONTAL_POSITION,
-            0.f
-        );
-        menuBackground.setFillColor(
-            context.getColorsManager().getColorBlack()
-        );
     }
 
-    sf::RectangleShape menuBackground;
-
-    /* we use pointers in order to accelerate the execution (no object copy);
-       we could have used move sementics, but SFML does not provides move
-       constructors for rectangle shapes */
-    std::vector<std::unique_ptr<sf::RectangleShape>> sidesLines;
+    /* the black background and the two gradients are three quads with
+       one color per vertex: the whole menu gradient is one draw call,
+       the gradients are interpolated by the graphic card */
+    sf::VertexArray vertices {sf::Quads};
 
     const utils::Context& context;
 };
@@ -80,7 +62,7 @@ MenuGradient::MenuGradient(const utils::Context& context) :
 {
     /* this is a complex initialization,
        so it is handled by a dedicated method */
-    initializeGradientRectangles();
+    initializeGradientVertices();
 }
 
 /**
@@ -93,78 +75,64 @@ MenuGradient::~MenuGradient() = default;
  */
 void MenuGradient::display() const &
 {
-    auto& window = impl->context.getSfmlWindow();
-    window.draw(impl->menuBackground);
+    impl->context.getSfmlWindow().draw(impl->vertices);
+}
 
-    for (const auto& rectangle : impl->sidesLines)
-    {
-        window.draw(*rectangle);
-    }
+/**
+ *
+ */
+void MenuGradient::initializeGradientVertices() const &
+{
+    const auto opaque = impl->context.getColorsManager().getColorBlackCopy();
+    auto transparent = opaque;
+    transparent.a = 0;
+
+    /* the gradients are 510 pixels wide at each side of the background,
+       the alpha decreases by one every two pixels (255 to 0) */
+    constexpr float BACKGROUND_LEFT {480.f};
+    constexpr float BACKGROUND_RIGHT {1100.f};
+    constexpr float GRADIENT_WIDTH {510.f};
+
+    appendQuad(
+        BACKGROUND_LEFT - GRADIENT_WIDTH,
+        BACKGROUND_LEFT,
+        transparent,
+        opaque
+    );
+
+    appendQuad(
+        BACKGROUND_LEFT,
+        BACKGROUND_RIGHT,
+        opaque,
+        opaque
+    );
+
+    appendQuad(
+        BACKGROUND_RIGHT,
+        BACKGROUND_RIGHT + GRADIENT_WIDTH,
+        opaque,
+        transparent
+    );
 }
 
 /**
  *
  */
-void MenuGradient::initializeGradientRectangles() const &
+void MenuGradient::appendQuad(
+    const float& left,
+    const float& right,
+    const sf::Color& leftColor,
+    const sf::Color& rightColor
+) const &
 {
-    constexpr float LEFT_SIDE_HORIZONTAL_POSITION {479.f};
-    float horizontalPosition {LEFT_SIDE_HORIZONTAL_POSITION};
-
-    sf::Color effectColor
-        {impl->context.getColorsManager().getColorBlackCopy()};
-
-    constexpr unsigned short SURFACES_AMOUNT {1020};
-    for (
-        unsigned short index {SURFACES_AMOUNT};
-        index > 0;
-        index -= 1
-    )
-    {
-        auto rectangle = std::make_unique<sf::RectangleShape>();
-
-        constexpr float RECTANGLES_COMMON_VERTICAL_POSITION {0.f};
-        rectangle->setPosition(
-            horizontalPosition,
-            RECTANGLES_COMMON_VERTICAL_POSITION
-        );
-
-        constexpr float RECTANGLES_COMMON_WIDTH {1.f};
-        rectangle->setSize(
-            sf::Vector2f(
-                RECTANGLES_COMMON_WIDTH,
-                window::HEIGHT
-            )
-        );
-
-        rectangle->setFillColor(effectColor);
-
-        constexpr unsigned short SIDE_SURFACES_AMOUNT {510};
-        if(index >= SIDE_SURFACES_AMOUNT)
-        {
-            horizontalPosition -= 1;
-        }
-        else
-        {
-            horizontalPosition += 1;
-        }
-
-        if (index == SIDE_SURFACES_AMOUNT)
-        {
-            constexpr float RIGHT_SIDE_HORIZONTAL_POSITION {1099.f};
-            horizontalPosition = RIGHT_SIDE_HORIZONTAL_POSITION;
-
-            constexpr sf::Uint8 DEFAULT_EFFECT_COLOR_ALPHA {255};
-            effectColor.a = DEFAULT_EFFECT_COLOR_ALPHA;
-        }
-
-        constexpr unsigned short SURFACES_WITH_SAME_ALPHA {2};
-        if (index % SURFACES_WITH_SAME_ALPHA == 0)
-        {
-            effectColor.a -= 1;
-        }
-
-        impl->sidesLines.push_back(std::move(rectangle));
-    }
+    constexpr float TOP {0.f};
+    constexpr float BOTTOM {static_cast<float>(window::HEIGHT)};
+
+    auto& vertices = impl->vertices;
+    vertices.append(sf::Vertex(sf::Vector2f(left, TOP), leftColor));
+    vertices.append(sf::Vertex(sf::Vector2f(right, TOP), rightColor));
+    vertices.append(sf::Vertex(sf::Vector2f(right, BOTTOM), rightColor));
+    vertices.append(sf::Vertex(sf::Vector2f(left, BOTTOM), leftColor));
 }
 
 }
@@ -28,9 +28,9 @@
 #include "FontsManager.hpp"
 #include "ColorsManager.hpp"
 #include "window.hpp"
+#include "ProfiledWindow.hpp"
 
 #include <SFML/Graphics/Text.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
 
 namespace memoris
 {
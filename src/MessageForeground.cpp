@@ -29,9 +29,9 @@
 #include "FontsManager.hpp"
 #include "fonts_sizes.hpp"
 #include "window.hpp"
+#include "ProfiledWindow.hpp"
 
 #include <SFML/Graphics/Text.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
 
 namespace memoris
 {
@@ -0,0 +1,334 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * @file MusicStreamer.cpp
+ * @package sounds
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "MusicStreamer.hpp"
+
+#include <SFML/Audio/Music.hpp>
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace memoris
+{
+namespace sounds
+{
+
+constexpr std::chrono::milliseconds CROSSFADE_DURATION {800};
+constexpr std::chrono::milliseconds CROSSFADE_STEP {20};
+
+constexpr float MAXIMUM_VOLUME {100.f};
+
+constexpr std::size_t DECKS_AMOUNT {2};
+
+class MusicStreamer::Impl
+{
+
+public:
+
+    /**
+     * @brief the music thread loop, waits for the requests and updates
+     * the volumes during the crossfade
+     */
+    void run() &;
+
+    /**
+     * @brief opens the given music into the deck that is not played,
+     * if it is not opened yet; ends the current crossfade before
+     *
+     * @param path the music file path
+     *
+     * @return const bool
+     */
+    const bool openSpareDeck(const std::string& path) &;
+
+    /**
+     * @brief stops the faded music and sets the played music volume
+     * to the maximum
+     */
+    void endCrossfade() &;
+
+    /**
+     * @brief returns the index of the deck that is not played
+     *
+     * @return const std::size_t
+     */
+    const std::size_t getSpareDeck() const & noexcept;
+
+    /* the decks and their paths are only used by the music thread */
+    std::array<sf::Music, DECKS_AMOUNT> decks;
+    std::array<std::string, DECKS_AMOUNT> decksPaths;
+
+    std::size_t playedDeck {0};
+
+    bool crossfading {false};
+    std::chrono::steady_clock::time_point crossfadeStartTime;
+
+    /* the requests of the main thread, protected by the mutex */
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    std::string prefetchedPath;
+    std::string playedPath;
+
+    bool stopRequested {false};
+    bool exitRequested {false};
+
+    /* declared last, the thread starts when every attribute exists */
+    std::thread thread;
+};
+
+/**
+ *
+ */
+void MusicStreamer::Impl::run() &
+{
+    while (true)
+    {
+        std::string prefetchRequest;
+        std::string playRequest;
+        bool stopRequest {false};
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            const auto hasRequests = [this]()
+            {
+                return exitRequested or stopRequested or
+                    not prefetchedPath.empty() or not playedPath.empty();
+            };
+
+            if (crossfading)
+            {
+                condition.wait_for(
+                    lock,
+                    CROSSFADE_STEP,
+                    hasRequests
+                );
+            }
+            else
+            {
+                condition.wait(
+                    lock,
+                    hasRequests
+                );
+            }
+
+            if (exitRequested)
+            {
+                break;
+            }
+
+            prefetchRequest.swap(prefetchedPath);
+            playRequest.swap(playedPath);
+            stopRequest = stopRequested;
+            stopRequested = false;
+        }
+
+        if (stopRequest)
+        {
+            crossfading = false;
+
+            for (auto& deck : decks)
+            {
+                deck.stop();
+            }
+        }
+
+        if (not prefetchRequest.empty())
+        {
+            openSpareDeck(prefetchRequest);
+        }
+
+        if (
+            not playRequest.empty() and
+            (
+                playRequest != decksPaths[playedDeck] or
+                decks[playedDeck].getStatus() != sf::Music::Playing
+            ) and
+            openSpareDeck(playRequest)
+        )
+        {
+            auto& deck = decks[getSpareDeck()];
+            deck.setLoop(true);
+            deck.setVolume(0.f);
+            deck.play();
+
+            playedDeck = getSpareDeck();
+
+            crossfading = true;
+            crossfadeStartTime = std::chrono::steady_clock::now();
+        }
+
+        if (not crossfading)
+        {
+            continue;
+        }
+
+        const float progress =
+            static_cast<float>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - crossfadeStartTime
+                ).count()
+            ) / CROSSFADE_DURATION.count();
+
+        if (progress >= 1.f)
+        {
+            endCrossfade();
+
+            continue;
+        }
+
+        decks[playedDeck].setVolume(MAXIMUM_VOLUME * progress);
+        decks[getSpareDeck()].setVolume(MAXIMUM_VOLUME * (1.f - progress));
+    }
+
+    for (auto& deck : decks)
+    {
+        deck.stop();
+    }
+}
+
+/**
+ *
+ */
+const bool MusicStreamer::Impl::openSpareDeck(const std::string& path) &
+{
+    if (crossfading)
+    {
+        endCrossfade();
+    }
+
+    const auto spareDeck = getSpareDeck();
+    auto& spareDeckPath = decksPaths[spareDeck];
+
+    if (spareDeckPath == path)
+    {
+        return true;
+    }
+
+    /* cleared first, a music that cannot be opened
+       is opened again when it is requested again */
+    spareDeckPath.clear();
+
+    if (not decks[spareDeck].openFromFile(path))
+    {
+        return false;
+    }
+
+    spareDeckPath = path;
+
+    return true;
+}
+
+/**
+ *
+ */
+void MusicStreamer::Impl::endCrossfade() &
+{
+    crossfading = false;
+
+    decks[getSpareDeck()].stop();
+    decks[playedDeck].setVolume(MAXIMUM_VOLUME);
+}
+
+/**
+ *
+ */
+const std::size_t MusicStreamer::Impl::getSpareDeck() const & noexcept
+{
+    return (playedDeck + 1) % DECKS_AMOUNT;
+}
+
+/**
+ *
+ */
+MusicStreamer::MusicStreamer() :
+    impl(std::make_unique<Impl>())
+{
+    impl->thread = std::thread(
+        &Impl::run,
+        impl.get()
+    );
+}
+
+/**
+ *
+ */
+MusicStreamer::~MusicStreamer()
+{
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        impl->exitRequested = true;
+    }
+
+    impl->condition.notify_one();
+    impl->thread.join();
+}
+
+/**
+ *
+ */
+void MusicStreamer::prefetch(const std::string& path) const &
+{
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        impl->prefetchedPath = path;
+    }
+
+    impl->condition.notify_one();
+}
+
+/**
+ *
+ */
+void MusicStreamer::play(const std::string& path) const &
+{
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        impl->playedPath = path;
+    }
+
+    impl->condition.notify_one();
+}
+
+/**
+ *
+ */
+void MusicStreamer::stop() const &
+{
+    {
+        std::lock_guard<std::mutex> lock(impl->mutex);
+        impl->stopRequested = true;
+
+        /* a music requested before the stop is not played */
+        impl->playedPath.clear();
+    }
+
+    impl->condition.notify_one();
+}
+
+}
+}
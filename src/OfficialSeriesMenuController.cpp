@@ -33,21 +33,18 @@
 #include "window.hpp"
 #include "SoundsManager.hpp"
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
+#include "ContentCatalog.hpp"
 
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Window/Event.hpp>
 
-#include <fstream>
 
 namespace memoris
 {
 namespace controllers
 {
 
-constexpr char GAMES_FILES_DIRECTORY[] {"data/games/"};
-constexpr char GAMES_FILES_EXTENSION[] {".game"};
-
 class OfficialSeriesMenuController::Impl
 {
 
@@ -69,13 +66,8 @@ public:
 
     sf::Text title;
 
-    /* not set into the implementation constructor as it needs
-       a call to the Controller parent method getContext(),
-       not set directly into the required function
-       as this is a virtual function marked as noexcept:
-       opening the file there would force us to remove "noexcept"
-       from all the others definitions */
-    unsigned short lastUnlockedSerie;
+    /* read from the content catalog by the controller constructor */
+    unsigned short lastUnlockedSerie {0};
 };
 
 /**
@@ -87,18 +79,14 @@ OfficialSeriesMenuController::OfficialSeriesMenuController(
     AbstractMenuController(context),
     impl(std::make_unique<Impl>(context))
 {
-    std::ifstream file;
-    file.open(
-        GAMES_FILES_DIRECTORY +
-        getContext().getGameName() +
-        GAMES_FILES_EXTENSION
+    /* the game file is not opened again, its content is indexed
+       by the catalog */
+    const auto game = context.getContentCatalog().getEntry(
+        managers::ContentDirectory::Games,
+        context.getGameName()
     );
 
-    /* get a character from file, substract the value of 48
-       in order to find numeric value from character */
-    char serieCharacter;
-    file.get(serieCharacter);
-    impl->lastUnlockedSerie = serieCharacter - '0';
+    impl->lastUnlockedSerie = game == nullptr ? 0 : game->lastUnlockedSerie;
 
     constexpr float EASY_VERTICAL_POSITION {270.f};
     std::unique_ptr<items::MenuItem> easy(
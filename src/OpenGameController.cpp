@@ -32,9 +32,10 @@
 #include "FilesSelectionListWidget.hpp"
 #include "Cursor.hpp"
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
+#include "ContentCatalog.hpp"
 
 #include <SFML/Graphics/Text.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Window/Event.hpp>
 
 #include <fstream>
@@ -44,7 +45,6 @@ namespace memoris
 namespace controllers
 {
 
-constexpr char GAMES_FILES_DIRECTORY[] {"data/games/"};
 
 class OpenGameController::Impl
 {
@@ -54,7 +54,7 @@ public:
     Impl(const utils::Context& context) :
         list(
             context,
-            GAMES_FILES_DIRECTORY
+            managers::ContentDirectory::Games
         ),
         cursor(context)
     {
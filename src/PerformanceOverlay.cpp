@@ -0,0 +1,118 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file PerformanceOverlay.cpp
+ * @package widgets
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "PerformanceOverlay.hpp"
+
+#include "Context.hpp"
+#include "FontsManager.hpp"
+#include "ColorsManager.hpp"
+#include "FrameProfiler.hpp"
+#include "ProfiledWindow.hpp"
+
+#include <SFML/Graphics/Text.hpp>
+
+#include <iomanip>
+#include <sstream>
+
+namespace memoris
+{
+namespace widgets
+{
+
+class PerformanceOverlay::Impl
+{
+
+public:
+
+    Impl(const utils::Context& context) :
+        context(context)
+    {
+        constexpr unsigned int TEXT_SIZE {20};
+        text.setFont(context.getFontsManager().getTextFont());
+        text.setCharacterSize(TEXT_SIZE);
+        text.setFillColor(context.getColorsManager().getColorGreen());
+
+        constexpr float OVERLAY_POSITION {5.f};
+        text.setPosition(
+            OVERLAY_POSITION,
+            OVERLAY_POSITION
+        );
+    }
+
+    const utils::Context& context;
+
+    std::uint64_t lastUpdateTime {0};
+
+    sf::Text text;
+};
+
+/**
+ *
+ */
+PerformanceOverlay::PerformanceOverlay(const utils::Context& context) :
+    impl(std::make_unique<Impl>(context))
+{
+}
+
+/**
+ *
+ */
+PerformanceOverlay::~PerformanceOverlay() = default;
+
+/**
+ *
+ */
+void PerformanceOverlay::display() const &
+{
+    const auto& profiler = impl->context.getFrameProfiler();
+    const auto time = profiler.getTime();
+
+    /* the percentiles are computed over the whole ring buffer,
+       this is not done at every frame */
+    constexpr std::uint64_t UPDATE_INTERVAL {500000};
+
+    if (time - impl->lastUpdateTime > UPDATE_INTERVAL)
+    {
+        const auto statistics = profiler.getStatistics();
+
+        constexpr double MICROSECONDS_PER_MILLISECOND {1000.0};
+
+        std::ostringstream stream;
+        stream << std::fixed << std::setprecision(1)
+            << "p50 " << statistics.medianFrameTime /
+                MICROSECONDS_PER_MILLISECOND << " ms  "
+            << "p99 " << statistics.slowFrameTime /
+                MICROSECONDS_PER_MILLISECOND << " ms  "
+            << statistics.drawCalls << " draws";
+
+        impl->text.setString(stream.str());
+
+        impl->lastUpdateTime = time;
+    }
+
+    impl->context.getSfmlWindow().draw(impl->text);
+}
+
+}
+}
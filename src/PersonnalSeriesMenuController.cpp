@@ -33,8 +33,9 @@
 #include "Cursor.hpp"
 #include "PlayingSerieManager.hpp"
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
+#include "ContentCatalog.hpp"
 
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Window/Event.hpp>
 
@@ -51,7 +52,7 @@ public:
     Impl(const utils::Context& context) :
         list(
             context,
-            "data/series/personals"
+            managers::ContentDirectory::PersonalSeries
         ),
         cursor(context)
     {
@@ -25,9 +25,9 @@
 #include "PickUpEffect.hpp"
 
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
 
 #include <SFML/Graphics/Sprite.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
 
 namespace memoris
 {
@@ -40,17 +40,20 @@ class PickUpEffect::Impl
 public:
 
     Impl(
-        const sf::Texture& texture,
+        const std::shared_ptr<const sf::Texture>& texture,
         const std::pair<float, float>& positions
-    )
+    ) :
+        texture(texture)
     {
-        sprite.setTexture(texture);
+        sprite.setTexture(*texture);
         sprite.setPosition(
             positions.first,
             positions.second
         );
     }
 
+    const std::shared_ptr<const sf::Texture> texture;
+
     sf::Sprite sprite;
 
     sf::Uint32 animationLastUpdateTime {0};
@@ -62,7 +65,7 @@ public:
  *
  */
 PickUpEffect::PickUpEffect(
-    const sf::Texture& texture,
+    const std::shared_ptr<const sf::Texture>& texture,
     const std::pair<float, float>& positions
 ) :
     impl(
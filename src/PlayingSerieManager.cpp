@@ -25,11 +25,14 @@
 #include "PlayingSerieManager.hpp"
 
 #include "SerieResult.hpp"
+#include "level_files.hpp"
 
 #include <SFML/System/String.hpp>
 
 #include <fstream>
 #include <queue>
+#include <future>
+#include <system_error>
 
 namespace memoris
 {
@@ -61,6 +64,12 @@ public:
 
     std::string serieName;
 
+    /* the front level of the queue, loaded by a worker thread while the
+       current level is played; the future is not valid if no loading
+       is in progress; the worker only accesses its own copy of the level
+       path, so no synchronization is required */
+    std::future<levels::LevelData> nextLevel;
+
     SerieType type {SerieType::Official};
 
     /**
@@ -111,13 +120,19 @@ const size_t PlayingSerieManager::getRemainingLevelsAmount() const & noexcept
 /**
  *
  */
-const std::string PlayingSerieManager::getNextLevelName() const &
+levels::LevelData PlayingSerieManager::getNextLevel() const &
 {
+    auto& nextLevel = impl->nextLevel;
+
     /* get the front item of the queue and
        delete it from the container */
-    auto& levels = impl->levels;
-    std::string level = levels.front();
-    levels.pop();
+    impl->levels.pop();
+
+    /* wait for the worker if the level is not loaded yet; rethrows the
+       loading exception if the level file cannot be loaded */
+    levels::LevelData level = nextLevel.get();
+
+    prefetchNextLevel();
 
     return level;
 }
@@ -141,8 +156,11 @@ void PlayingSerieManager::loadSerieFileContent(
 {
     impl->type = type;
 
-    /* clear the queue containing the levels of the previous serie */
+    /* clear the queue containing the levels of the previous serie; the
+       prefetched level of the previous serie is not used anymore (waits
+       for the worker if the loading is still in progress) */
     impl->levels = std::queue<std::string>();
+    impl->nextLevel = std::future<levels::LevelData>();
 
     impl->levelIndex = 0;
 
@@ -181,6 +199,8 @@ void PlayingSerieManager::loadSerieFileContent(
     impl->serieName = name;
 
     file.close();
+
+    prefetchNextLevel();
 }
 
 /**
@@ -319,5 +339,42 @@ const sf::String PlayingSerieManager::fillMissingTimeDigits(
     return timeNumber;
 }
 
+/**
+ *
+ */
+void PlayingSerieManager::prefetchNextLevel() const &
+{
+    const auto& levels = impl->levels;
+
+    if (levels.empty())
+    {
+        return;
+    }
+
+    const std::string path = "data/levels/" + getSerieTypeAsString() + "/" +
+        levels.front();
+
+    try
+    {
+        /* std::launch::async forces the creation of a new thread, the
+           default policy could defer the loading until get() is called */
+        impl->nextLevel = std::async(
+            std::launch::async,
+            levels::loadLevelFile,
+            path
+        );
+    }
+    catch (const std::system_error&)
+    {
+        /* no thread can be created, the level is loaded synchronously
+           when get() is called; the level got by the caller is kept */
+        impl->nextLevel = std::async(
+            std::launch::deferred,
+            levels::loadLevelFile,
+            path
+        );
+    }
+}
+
 }
 }
@@ -0,0 +1,194 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file ProfiledWindow.cpp
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "ProfiledWindow.hpp"
+
+#include "FrameProfiler.hpp"
+
+#include <SFML/System/Sleep.hpp>
+
+namespace memoris
+{
+namespace utils
+{
+
+/**
+ *
+ */
+ProfiledWindow::ProfiledWindow(
+    const FrameProfiler& profiler,
+    const sf::VideoMode& mode,
+    const sf::String& title,
+    const sf::Uint32& style
+) :
+    sf::RenderWindow(
+        mode,
+        title,
+        style
+    ),
+    profiler(profiler)
+{
+}
+
+/**
+ *
+ */
+void ProfiledWindow::draw(
+    const sf::Drawable& drawable,
+    const sf::RenderStates& states
+)
+{
+    if (not frameDrawn)
+    {
+        return;
+    }
+
+    const auto startTime = profiler.getTime();
+
+    sf::RenderWindow::draw(
+        drawable,
+        states
+    );
+
+    profiler.addSectionTime(
+        FrameProfiler::Section::Draw,
+        startTime
+    );
+    profiler.addDrawCall();
+}
+
+/**
+ *
+ */
+void ProfiledWindow::draw(
+    const sf::Vertex* vertices,
+    std::size_t verticesAmount,
+    sf::PrimitiveType type,
+    const sf::RenderStates& states
+)
+{
+    if (not frameDrawn)
+    {
+        return;
+    }
+
+    const auto startTime = profiler.getTime();
+
+    sf::RenderWindow::draw(
+        vertices,
+        verticesAmount,
+        type,
+        states
+    );
+
+    profiler.addSectionTime(
+        FrameProfiler::Section::Draw,
+        startTime
+    );
+    profiler.addDrawCall();
+}
+
+/**
+ *
+ */
+bool ProfiledWindow::pollEvent(sf::Event& event)
+{
+    const auto startTime = profiler.getTime();
+
+    const bool polled = sf::RenderWindow::pollEvent(event);
+
+    profiler.addSectionTime(
+        FrameProfiler::Section::Events,
+        startTime
+    );
+
+    /* any event may change the scene (mouse moves, pressed keys...)
+       or require to draw it again (the window is exposed...) */
+    if (polled)
+    {
+        invalidate();
+    }
+
+    return polled;
+}
+
+/**
+ *
+ */
+void ProfiledWindow::setFramerateLimit(unsigned int limit)
+{
+    constexpr float ONE_SECOND {1.f};
+    frameDuration = limit == 0 ?
+        sf::Time::Zero :
+        sf::seconds(ONE_SECOND / static_cast<float>(limit));
+
+    sf::RenderWindow::setFramerateLimit(limit);
+}
+
+/**
+ *
+ */
+void ProfiledWindow::invalidate() & noexcept
+{
+    invalidated = true;
+}
+
+/**
+ *
+ */
+const bool ProfiledWindow::startFrame() & noexcept
+{
+    frameDrawn = invalidated;
+    invalidated = false;
+
+    return frameDrawn;
+}
+
+/**
+ *
+ */
+void ProfiledWindow::endFrame() &
+{
+    if (frameDrawn)
+    {
+        /* SFML waits for the frames limit before displaying */
+        display();
+    }
+    else
+    {
+        /* nothing is sent to the graphic card, the process sleeps for the
+           rest of the frame instead of being woken up by the swap */
+        const auto elapsedTime = frameClock.getElapsedTime();
+
+        if (elapsedTime < frameDuration)
+        {
+            sf::sleep(frameDuration - elapsedTime);
+        }
+    }
+
+    frameClock.restart();
+}
+
+}
+}
@@ -0,0 +1,170 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * @file ResourcesLoader.cpp
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "ResourcesLoader.hpp"
+
+#include "resource_pack.hpp"
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace memoris
+{
+namespace utils
+{
+
+class ResourcesLoader::Impl
+{
+
+public:
+
+    Impl() :
+        pack(resources::mapResourcePack(resources::RESOURCE_PACK_PATH))
+    {
+    }
+
+    resources::ResourcePack pack;
+};
+
+/**
+ *
+ */
+ResourcesLoader::ResourcesLoader() :
+    impl(std::make_unique<Impl>())
+{
+}
+
+/**
+ *
+ */
+ResourcesLoader::~ResourcesLoader() = default;
+
+/**
+ *
+ */
+std::vector<sf::Image> ResourcesLoader::decodePictures(
+    const std::vector<std::string>& names
+) const &
+{
+    std::vector<const resources::ResourceData*> packedPictures;
+    packedPictures.reserve(names.size());
+
+    for (const auto& name : names)
+    {
+        packedPictures.push_back(
+            &resources::getResource(
+                impl->pack,
+                name
+            )
+        );
+    }
+
+    /* the workers only write into their own pictures */
+    std::vector<sf::Image> pictures(names.size());
+
+    std::atomic<std::size_t> nextPicture {0};
+    std::atomic<bool> failed {false};
+
+    const auto decodeNextPictures = [&]()
+    {
+        for (
+            auto index = nextPicture.fetch_add(1);
+            index < packedPictures.size();
+            index = nextPicture.fetch_add(1)
+        )
+        {
+            const auto& data = *packedPictures[index];
+
+            if (
+                not pictures[index].loadFromMemory(
+                    data.bytes,
+                    data.size
+                )
+            )
+            {
+                failed = true;
+            }
+        }
+    };
+
+    /* the current thread is also a worker */
+    const auto workersAmount = std::min(
+        std::max(
+            std::thread::hardware_concurrency(),
+            1u
+        ),
+        static_cast<unsigned int>(names.size())
+    );
+
+    std::vector<std::future<void>> workers;
+
+    for (
+        unsigned int worker {1};
+        worker < workersAmount;
+        worker += 1
+    )
+    {
+        workers.push_back(
+            std::async(
+                std::launch::async,
+                decodeNextPictures
+            )
+        );
+    }
+
+    decodeNextPictures();
+
+    for (auto& worker : workers)
+    {
+        worker.get();
+    }
+
+    if (failed)
+    {
+        throw std::invalid_argument("Cannot decode the packed pictures");
+    }
+
+    return pictures;
+}
+
+/**
+ *
+ */
+const resources::ResourceData& ResourcesLoader::getResource(
+    const std::string& name
+) const &
+{
+    return resources::getResource(
+        impl->pack,
+        name
+    );
+}
+
+}
+}
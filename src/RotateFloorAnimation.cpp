@@ -25,16 +25,19 @@
 #include "RotateFloorAnimation.hpp"
 
 #include "SoundsManager.hpp"
-#include "Cell.hpp"
 #include "Level.hpp"
 #include "Context.hpp"
-#include "dimensions.hpp"
+#include "floor_permutations.hpp"
+#include "game_state.hpp"
 
 namespace memoris
 {
 namespace animations
 {
 
+constexpr sf::Int32 ANIMATION_STEPS_INTERVAL {50};
+constexpr unsigned short ROTATION_STEP {5};
+
 class RotateFloorAnimation::Impl
 {
 
@@ -69,7 +72,9 @@ RotateFloorAnimation::RotateFloorAnimation(
     LevelAnimation(
         context,
         level,
-        floor
+        floor,
+        ANIMATION_STEPS_INTERVAL,
+        FirstStep::Immediate
     ),
     impl(std::make_unique<Impl>(moveDirection))
 {
@@ -85,33 +90,43 @@ RotateFloorAnimation::~RotateFloorAnimation() = default;
  */
 void RotateFloorAnimation::renderAnimation() &
 {
-    const auto& context = getContext();
     const auto& level = getLevel();
     const auto& floor = getFloor();
 
-    level->display(floor);
-
-    constexpr sf::Uint32 ANIMATION_INTERVAL {50};
-    if (
-        context.getClockMillisecondsTime() - 
-        getAnimationLastUpdateTime() < ANIMATION_INTERVAL
+    for (
+        auto steps = getElapsedAnimationSteps();
+        steps != 0 and not isFinished();
+        steps -= 1
     )
     {
-        return;
-    }
+        playNextAnimationStep();
 
-    playNextAnimationStep();
+        if (getAnimationSteps() == 18)
+        {
+            level->deleteTransform();
 
-    if (getAnimationSteps() == 18)
-    {
-        level->deleteTransform();
+            endsAnimation();
 
-        endsAnimation();
+            rotateCells();
+        }
 
-        rotateCells();
+        incrementAnimationStep();
     }
 
-    incrementAnimationStep();
+    if (isFinished())
+    {
+        level->display(floor);
+
+        return;
+    }
+
+    /* the floor is rendered between the previous step angle and the
+       current one, according to the progression of the current step */
+    const float remainingStep = 1.f - getStepInterpolation();
+    level->display(
+        floor,
+        -static_cast<float>(ROTATION_STEP * impl->direction) * remainingStep
+    );
 }
 
 /**
@@ -128,7 +143,6 @@ void RotateFloorAnimation::playNextAnimationStep() const &
         level->createTransform();
     }
 
-    constexpr unsigned short ROTATION_STEP {5};
     level->rotateAllCells(ROTATION_STEP * impl->direction);
 }
 
@@ -137,344 +151,25 @@ void RotateFloorAnimation::playNextAnimationStep() const &
  */
 void RotateFloorAnimation::rotateCells() const &
 {
-    constexpr unsigned short CELLS_PER_SIDE = dimensions::CELLS_PER_FLOOR / 2;
-    constexpr unsigned short HALF_CELLS_PER_LINE =
-        dimensions::CELLS_PER_LINE / 2;
-    const auto& cells = getLevel()->getCells();
+    const auto& permutation = game::getFloorPermutation(
+        impl->direction == -1 ?
+            game::Transformation::LeftRotation :
+            game::Transformation::RightRotation
+    );
 
-    constexpr unsigned short FLOORS_PER_LEVEL {10};
     for (
-        unsigned short floor = 0;
-        floor < FLOORS_PER_LEVEL;
+        unsigned short floor {0};
+        floor < game::FLOORS_PER_LEVEL;
         floor += 1
     )
     {
-        std::vector<std::unique_ptr<entities::Cell>> rightQuarterCells;
-
-        for (
-            unsigned short index = floor * dimensions::CELLS_PER_FLOOR;
-            index < floor * dimensions::CELLS_PER_FLOOR + CELLS_PER_SIDE;
-            index += 1
-        )
-        {
-            if (index % dimensions::CELLS_PER_LINE < HALF_CELLS_PER_LINE)
-            {
-                continue;
-            }
-
-            auto cell = getCellCopy(*cells[index]);
-            rightQuarterCells.push_back(std::move(cell));
-        }
-
-        std::vector<std::unique_ptr<entities::Cell>> leftBottomQuarterCells;
-
-        for (
-            unsigned short index =
-                floor * dimensions::CELLS_PER_FLOOR + CELLS_PER_SIDE;
-            index < (floor + 1) * dimensions::CELLS_PER_FLOOR;
-            index += 1
-        )
-        {
-            if (index % dimensions::CELLS_PER_LINE >= HALF_CELLS_PER_LINE)
-            {
-                continue;
-            }
-
-            auto cell = getCellCopy(*cells[index]);
-            leftBottomQuarterCells.push_back(std::move(cell));
-        }
-
-        for (
-            unsigned short index = floor * dimensions::CELLS_PER_FLOOR;
-            index < floor * dimensions::CELLS_PER_FLOOR + CELLS_PER_SIDE;
-            index += 1
-        )
-        {
-            if (index % dimensions::CELLS_PER_LINE >= HALF_CELLS_PER_LINE)
-            {
-                continue;
-            }
-
-            rotateCell(
-                index,
-                floor
-            );
-        }
-
-        for (
-            unsigned short index =
-                floor * dimensions::CELLS_PER_FLOOR + CELLS_PER_SIDE;
-            index < (floor + 1) * dimensions::CELLS_PER_FLOOR;
-            index += 1
-        )
-        {
-            if (index % dimensions::CELLS_PER_LINE < HALF_CELLS_PER_LINE)
-            {
-                continue;
-            }
-
-            rotateCell(
-                index,
-                floor
-            );
-        }
-
-        constexpr unsigned short CELLS_PER_QUARTER = CELLS_PER_SIDE / 2;
-
-        for (
-            unsigned short index = 0;
-            index < CELLS_PER_QUARTER;
-            index += 1
-        )
-        {
-            rotateCellFromQuarter(
-                index,
-                (
-                    floor * dimensions::CELLS_PER_FLOOR +
-                    dimensions::CELLS_PER_LINE * (
-                        index / HALF_CELLS_PER_LINE
-                    ) + HALF_CELLS_PER_LINE + (
-                        index % HALF_CELLS_PER_LINE
-                    )
-                ),
-                floor,
-                rightQuarterCells
-            );
-        }
-
-        unsigned short convertedIndex =
-            floor * dimensions::CELLS_PER_FLOOR + CELLS_PER_SIDE;
-
-        for (
-            unsigned short index = 0;
-            index < CELLS_PER_QUARTER;
-            index += 1
-        )
-        {
-            if (
-                index % HALF_CELLS_PER_LINE == 0 and
-                index != 0
-            )
-            {
-                convertedIndex += HALF_CELLS_PER_LINE;
-            }
-
-            rotateCellFromQuarter(
-                index,
-                convertedIndex,
-                floor,
-                leftBottomQuarterCells
-            );
-
-            convertedIndex += 1;
-        }
-    }
-
-    const auto& level = getLevel();
-    const auto currentPlayerIndex = level->getPlayerCellIndex();
-    const auto playerFloor = level->getPlayerFloor();
-
-    const std::pair<short, short> coordinates =
-        getCoordinatesFromIndex(
-            currentPlayerIndex,
-            playerFloor
-        );
-
-    short x = coordinates.second;
-    short y = coordinates.first;
-    updateCoordinates(x, y);
-
-    auto destinationPlayerIndex = getIndexFromCoordinates(x, y);
-    destinationPlayerIndex += playerFloor * dimensions::CELLS_PER_FLOOR;
-    level->setPlayerCellIndex(destinationPlayerIndex);
-}
-
-/**
- *
- */
-void RotateFloorAnimation::rotateCell(
-    const unsigned short& index,
-    const unsigned short& floor
-) const &
-{
-    const auto& cells = getLevel()->getCells();
-    const auto& cell = cells[index];
-    const auto type = cell->getType();
-    const std::pair<short, short> coordinates =
-        getCoordinatesFromIndex(
-            index,
-            floor
+        permuteFloorCells(
+            floor,
+            permutation
         );
-
-    /* rotate (x,y) around the origin (0, 0) results into (-y, x) */
-    short x = coordinates.second;
-    short y = coordinates.first;
-    updateCoordinates(x, y);
-
-    auto destinationIndex = getIndexFromCoordinates(x, y);
-    destinationIndex += floor * dimensions::CELLS_PER_FLOOR;
-
-    const auto& destinationCell = cells[destinationIndex];
-    destinationCell->setType(type);
-
-    updateDestinationCellVisibility(
-        *cell,
-        *destinationCell
-    );
-}
-
-/**
- *
- */
-void RotateFloorAnimation::rotateCellFromQuarter(
-    const unsigned short& index,
-    const unsigned short& convertedIndex,
-    const unsigned short& floor,
-    const std::vector<std::unique_ptr<entities::Cell>>& cellsCopy
-) const &
-{
-    const auto& cell = cellsCopy[index];
-    const auto type = cell->getType();
-    const std::pair<short, short> coordinates =
-        getCoordinatesFromIndex(
-            convertedIndex,
-            floor
-        );
-
-    /* rotate (x,y) around the origin (0, 0) results into (-y, x) */
-    short x = coordinates.second;
-    short y = coordinates.first;
-    updateCoordinates(x, y);
-
-    const auto& cells = getLevel()->getCells();
-
-    auto destinationIndex = getIndexFromCoordinates(x, y);
-    destinationIndex += floor * dimensions::CELLS_PER_FLOOR;
-
-    const auto& destinationCell = cells[destinationIndex];
-
-    destinationCell->setType(type);
-
-    updateDestinationCellVisibility(
-        *cell,
-        *destinationCell
-    );
-}
-
-/**
- *
- */
-std::pair<short, short>
-RotateFloorAnimation::getCoordinatesFromIndex(
-    const unsigned short& index,
-    const unsigned short& floor
-) const & noexcept
-{
-    /* every line contains 16 cells, so the middle is at index 8 */
-    short x = (index % dimensions::CELLS_PER_LINE) - 8;
-    short y = (
-        (
-            index - floor * dimensions::CELLS_PER_FLOOR
-        ) / dimensions::CELLS_PER_LINE
-    ) - 8;
-
-    /* we increment the coordinates in order
-       to have orthogonal coordinates rotable around the origin */
-
-    if (x >= 0)
-    {
-        x += 1;
-    }
-
-    if (y >= 0)
-    {
-        y += 1;
-    }
-
-    return std::pair<short, short>(x, y);
-}
-
-/**
- *
- */
-unsigned short RotateFloorAnimation::getIndexFromCoordinates(
-    short x,
-    short y
-) const & noexcept
-{
-    if (x > 0)
-    {
-        x -= 1;
-    }
-
-    if (y > 0)
-    {
-        y -= 1;
-    }
-
-    x += 8;
-    y += 8;
-
-    return y * dimensions::CELLS_PER_LINE + x;
-}
-
-/**
- *
- */
-void RotateFloorAnimation::updateDestinationCellVisibility(
-    const entities::Cell& source,
-    const entities::Cell& destination
-) const &
-{
-    const auto& context = getContext();
-    if (source.isVisible())
-    {
-        destination.show(context);
     }
-    else
-    {
-        destination.hide(context);
-    }
-}
-
-/**
- *
- */
-std::unique_ptr<entities::Cell> RotateFloorAnimation::getCellCopy(
-    const entities::Cell& source
-) const &
-{
-    std::unique_ptr<entities::Cell> cell =
-        std::make_unique<entities::Cell>(
-            getContext(),
-            /* there is no need to have a specific cell position;
-               this container is used to store the cell type and visibility */
-            0,
-            0,
-            source.getType()
-        );
-
-    cell->setIsVisible(source.isVisible());
-
-    return cell;
-}
 
-/**
- *
- */
-void RotateFloorAnimation::updateCoordinates(
-    short& x,
-    short& y
-) const & noexcept
-{
-    if (impl->direction == -1)
-    {
-        y *= -1;
-    }
-    else
-    {
-        x *= -1;
-    }
+    getLevel()->setPlayerCellIndex(getUpdatedPlayerIndex());
 }
 
 }
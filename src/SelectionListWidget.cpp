@@ -29,11 +29,14 @@
 #include "FontsManager.hpp"
 #include "fonts_sizes.hpp"
 #include "TexturesManager.hpp"
+#include "ProfiledWindow.hpp"
 
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Text.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
+
+#include <array>
+#include <algorithm>
 
 namespace memoris
 {
@@ -46,6 +49,8 @@ constexpr float HEIGHT {600.f};
 constexpr float ITEMS_SEPARATION {50.f};
 constexpr float ARROWS_VERTICAL_POSITION {800.f};
 
+constexpr unsigned short VISIBLE_ITEMS_AMOUNT {12};
+
 class SelectionListWidget::Impl
 {
 
@@ -121,8 +126,10 @@ public:
         selector.setFillColor(colorsManager.getColorPartialDarkGrey());
 
         const auto& texturesManager = context.getTexturesManager();
-        arrowUp.setTexture(texturesManager.getScrollArrowUpTexture());
-        arrowDown.setTexture(texturesManager.getScrollArrowDownTexture());
+        arrowUpTexture = texturesManager.getScrollArrowUpTexture();
+        arrowDownTexture = texturesManager.getScrollArrowDownTexture();
+        arrowUp.setTexture(*arrowUpTexture);
+        arrowDown.setTexture(*arrowDownTexture);
 
         const float horizontalPositionCenter =
             horizontalPosition + WIDTH / 2.f;
@@ -143,6 +150,40 @@ public:
             horizontalPositionCenter + ARROW_WIDTH,
             ARROWS_VERTICAL_POSITION
         );
+
+        /* the rows never move, only their strings are updated */
+        const auto& font = context.getFontsManager().getTextFont();
+        const auto& white = colorsManager.getColorWhite();
+
+        for (
+            unsigned short index {0};
+            index < VISIBLE_ITEMS_AMOUNT;
+            index += 1
+        )
+        {
+            auto& row = rows[index];
+
+            row.setFont(font);
+            row.setCharacterSize(sizes::TEXT_SIZE);
+            row.setFillColor(white);
+            row.setPosition(
+                horizontalPosition,
+                VERTICAL_POSITION +
+                    ITEMS_SEPARATION * static_cast<float>(index)
+            );
+        }
+    }
+
+    /**
+     * @brief returns the index of the item displayed on the given row
+     *
+     * @param row the index of the row
+     *
+     * @return const std::size_t
+     */
+    const std::size_t getItemIndex(const short& row) const & noexcept
+    {
+        return firstVisibleItem + static_cast<std::size_t>(row);
     }
 
     const utils::Context& context;
@@ -153,14 +194,23 @@ public:
     sf::RectangleShape right;
     sf::RectangleShape selector;
 
+    managers::TextureHandle arrowUpTexture;
+    managers::TextureHandle arrowDownTexture;
+
     sf::Sprite arrowUp;
     sf::Sprite arrowDown;
 
-    std::vector<sf::Text> texts;
+    std::vector<std::string> items;
+
+    std::array<sf::Text, VISIBLE_ITEMS_AMOUNT> rows;
+
+    /* the index of the item of the first visible row */
+    std::size_t firstVisibleItem {0};
 
     /* signed because equals to -1 when nothing is selected */
     short selectorIndex {0};
-    short offset {0};
+
+    bool rowsUpdated {true};
 
     bool mouseHoverLeftArrow {false};
     bool mouseHoverRightArrow {false};
@@ -208,13 +258,16 @@ void SelectionListWidget::display(
     window.draw(impl->arrowUp);
     window.draw(impl->arrowDown);
 
-    const auto& texts = impl->texts;
-
-    if (texts.size() == 0)
+    if (impl->items.empty())
     {
         return;
     }
 
+    if (not impl->rowsUpdated)
+    {
+        updateVisibleRows();
+    }
+
     auto& selectorIndex = impl->selectorIndex;
     if(isMouseHoverItem(cursorPosition))
     {
@@ -231,22 +284,14 @@ void SelectionListWidget::display(
         selectorIndex = NO_SELECTION_INDEX;
     }
 
+    const auto& rows = impl->rows;
+
     std::for_each(
-        texts.cbegin(),
-        texts.cend(),
-        [&window] (const auto& text)
+        rows.cbegin(),
+        rows.cbegin() + getVisibleRowsAmount(),
+        [&window] (const sf::Text& row)
         {
-            const float& itemVerticalPosition = text.getPosition().y;
-
-            if (
-                itemVerticalPosition < VERTICAL_POSITION or
-                itemVerticalPosition >= VERTICAL_POSITION + HEIGHT
-            )
-            {
-                return;
-            }
-
-            window.draw(text);
+            window.draw(row);
         }
     );
 
@@ -270,7 +315,7 @@ void SelectionListWidget::display(
  */
 std::string SelectionListWidget::getCurrentItem() const &
 {
-    return impl->texts[impl->selectorIndex + impl->offset * -1].getString();
+    return impl->items[impl->getItemIndex(impl->selectorIndex)];
 }
 
 /**
@@ -280,7 +325,7 @@ const unsigned short SelectionListWidget::getItemsAmount() const & noexcept
 {
     /* everywhere this value is required,
        a comparison with unsigned variable is performed */
-    return static_cast<unsigned short>(impl->texts.size());
+    return static_cast<unsigned short>(impl->items.size());
 }
 
 /**
@@ -296,8 +341,7 @@ const short& SelectionListWidget::getCurrentIndex() const & noexcept
  */
 const bool SelectionListWidget::canScrollUp() const & noexcept
 {
-    constexpr unsigned short MIN_OFFSET {0};
-    return impl->mouseHoverLeftArrow and impl->offset != MIN_OFFSET;
+    return impl->mouseHoverLeftArrow and impl->firstVisibleItem != 0;
 }
 
 /**
@@ -305,15 +349,9 @@ const bool SelectionListWidget::canScrollUp() const & noexcept
  */
 const bool SelectionListWidget::canScrollDown() const & noexcept
 {
-    constexpr unsigned short VISIBLE_ITEMS_AMOUNT {12};
-
-    /* prevent comparison between signed and unsigned variables */
-    const auto& itemsAmount = static_cast<unsigned short>(impl->texts.size());
-
     return (
         impl->mouseHoverRightArrow and
-        itemsAmount >= VISIBLE_ITEMS_AMOUNT and
-        impl->offset * -1 + VISIBLE_ITEMS_AMOUNT != itemsAmount
+        impl->firstVisibleItem + VISIBLE_ITEMS_AMOUNT < impl->items.size()
     );
 }
 
@@ -321,27 +359,20 @@ const bool SelectionListWidget::canScrollDown() const & noexcept
  *
  */
 void SelectionListWidget::updateAllItemsPosition(const ListMovement& movement)
-    const &
+    const & noexcept
 {
-    short listMovement {-1};
+    auto& firstVisibleItem = impl->firstVisibleItem;
 
     if (movement == ListMovement::Up)
     {
-        listMovement = 1;
+        firstVisibleItem -= 1;
     }
-
-    impl->offset += listMovement;
-
-    const auto positionUpdate =
-        ITEMS_SEPARATION * static_cast<float>(listMovement);
-
-    for (sf::Text& text : impl->texts)
+    else
     {
-        text.setPosition(
-            impl->horizontalPosition,
-            text.getPosition().y + positionUpdate
-        );
+        firstVisibleItem += 1;
     }
+
+    impl->rowsUpdated = false;
 }
 
 /**
@@ -349,30 +380,21 @@ void SelectionListWidget::updateAllItemsPosition(const ListMovement& movement)
  */
 void SelectionListWidget::deleteSelectedItem() const &
 {
-    auto& texts = impl->texts;
+    auto& items = impl->items;
 
-    /* we can use the operator plus here between integers and iterator
-       because it is a random access iterator; we explicitly declare
-       the type to prevent oversights */
-    const std::vector<sf::Text>::iterator offsetIndex =
-        texts.begin() + impl->selectorIndex + impl->offset;
+    items.erase(items.begin() + impl->getItemIndex(impl->selectorIndex));
 
-    texts.erase(offsetIndex);
-
-    const auto& horizontalPosition = impl->horizontalPosition;
-
-    /* not a const_iterator as setPosition() modifies the iterated objects */
-    for (
-        auto iterator = offsetIndex;
-        iterator != texts.end();
-        ++iterator
+    /* the last row stays filled when the list is scrolled to the end */
+    auto& firstVisibleItem = impl->firstVisibleItem;
+    if (
+        firstVisibleItem != 0 and
+        firstVisibleItem + VISIBLE_ITEMS_AMOUNT > items.size()
     )
     {
-        iterator->setPosition(
-            horizontalPosition,
-            iterator->getPosition().y - ITEMS_SEPARATION
-        );
+        firstVisibleItem -= 1;
     }
+
+    impl->rowsUpdated = false;
 }
 
 /**
@@ -380,35 +402,18 @@ void SelectionListWidget::deleteSelectedItem() const &
  */
 void SelectionListWidget::addItem(std::string&& text) const &
 {
-    const auto& context = impl->context;
-
-    sf::Text surface(
-        text,
-        context.getFontsManager().getTextFont(),
-        sizes::TEXT_SIZE
-    );
-
-    surface.setFillColor(context.getColorsManager().getColorWhite());
-
-    auto& texts = impl->texts;
-
-    const auto& verticalPosition = VERTICAL_POSITION +
-        ITEMS_SEPARATION * static_cast<float>(texts.size());
+    impl->items.push_back(std::move(text));
 
-    surface.setPosition(
-        impl->horizontalPosition,
-        verticalPosition
-    );
-
-    texts.push_back(surface);
+    impl->rowsUpdated = false;
 }
 
 /**
  *
  */
-const std::vector<sf::Text>& SelectionListWidget::getTexts() const & noexcept
+const std::vector<std::string>& SelectionListWidget::getItems() const &
+    noexcept
 {
-    return impl->texts;
+    return impl->items;
 }
 
 /**
@@ -416,7 +421,9 @@ const std::vector<sf::Text>& SelectionListWidget::getTexts() const & noexcept
  */
 void SelectionListWidget::deleteAllItems() const & noexcept
 {
-    impl->texts.clear();
+    impl->items.clear();
+    impl->firstVisibleItem = 0;
+    impl->rowsUpdated = false;
 }
 
 /**
@@ -444,6 +451,39 @@ void SelectionListWidget::displaySelector() const &
     impl->context.getSfmlWindow().draw(selector);
 }
 
+/**
+ *
+ */
+const unsigned short SelectionListWidget::getVisibleRowsAmount() const &
+    noexcept
+{
+    return static_cast<unsigned short>(
+        std::min(
+            impl->items.size() - impl->firstVisibleItem,
+            static_cast<std::size_t>(VISIBLE_ITEMS_AMOUNT)
+        )
+    );
+}
+
+/**
+ *
+ */
+void SelectionListWidget::updateVisibleRows() const &
+{
+    const auto rowsAmount = getVisibleRowsAmount();
+
+    for (
+        unsigned short row {0};
+        row < rowsAmount;
+        row += 1
+    )
+    {
+        impl->rows[row].setString(impl->items[impl->getItemIndex(row)]);
+    }
+
+    impl->rowsUpdated = true;
+}
+
 /**
  *
  */
@@ -456,16 +496,9 @@ const bool SelectionListWidget::isMouseHoverItem(
 
     const auto& rightBorderHorizontalPosition =
         impl->horizontalPosition + WIDTH;
-    constexpr float BOTTOM_BORDER_VERTICAL_POSITION =
-        VERTICAL_POSITION + HEIGHT;
-
-    auto bottomPosition = VERTICAL_POSITION +
-        static_cast<float>(impl->texts.size()) * ITEMS_SEPARATION;
 
-    if (bottomPosition > BOTTOM_BORDER_VERTICAL_POSITION)
-    {
-        bottomPosition = BOTTOM_BORDER_VERTICAL_POSITION;
-    }
+    const auto bottomPosition = VERTICAL_POSITION +
+        static_cast<float>(getVisibleRowsAmount()) * ITEMS_SEPARATION;
 
     if (
         cursorHorizontalPosition < impl->horizontalPosition or
@@ -37,8 +37,9 @@
 #include "MessageForeground.hpp"
 #include "InputTextWidget.hpp"
 #include "window.hpp"
+#include "ProfiledWindow.hpp"
+#include "ContentCatalog.hpp"
 
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Window/Event.hpp>
 
@@ -85,7 +86,7 @@ public:
         cursor(context),
         filesLevelsList(
             context,
-            "data/levels/personals",
+            managers::ContentDirectory::PersonalLevels,
             ALL_LEVELS_LIST_HORIZONTAL_POSITION
         ),
         serieLevelsList(
@@ -455,10 +456,10 @@ void SerieEditorController::saveSerieFile(const std::string& name) const &
         std::fstream::out
     );
 
-    const auto& texts = impl->serieLevelsList.getTexts();
-    for (const auto& text : texts)
+    const auto& items = impl->serieLevelsList.getItems();
+    for (const auto& item : items)
     {
-        file << text.getString().toAnsiString() << std::endl;
+        file << item << std::endl;
     }
 }
 
@@ -508,7 +509,7 @@ void SerieEditorController::resetLevelsLists() const &
 
     const auto& filesLevelsList = impl->filesLevelsList;
     filesLevelsList.deleteAllItems();
-    filesLevelsList.loadFilesFromDirectory();
+    filesLevelsList.loadFilesFromCatalog();
 }
 
 /**
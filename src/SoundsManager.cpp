@@ -27,36 +27,88 @@
 
 #include "SoundsManager.hpp"
 
-#include "Sound.hpp"
+#include "AudioMixer.hpp"
+#include "sounds_ids.hpp"
+#include "controllers_ids.hpp"
+
+#include <vector>
 
 namespace memoris
 {
 namespace managers
 {
 
+/**
+ * @brief returns the sounds the given controller may play, so they are
+ * decoded before the controller creation; the screen transition sound is
+ * played at every controller change and is always expected
+ *
+ * @param id the controller id
+ *
+ * @return std::vector<sounds::SoundId>
+ */
+std::vector<sounds::SoundId> getControllerSounds(
+    const controllers::ControllerId& id
+)
+{
+    using controllers::ControllerId;
+    using sounds::SoundId;
+
+    switch(id)
+    {
+    case ControllerId::Game:
+    {
+        return {
+            SoundId::ScreenTransition,
+            SoundId::HideLevel,
+            SoundId::FoundStar,
+            SoundId::FoundLifeOrTime,
+            SoundId::FoundDeadOrLessTime,
+            SoundId::Collision,
+            SoundId::FloorSwitch,
+            SoundId::TimeOver,
+            SoundId::MirrorAnimation,
+            SoundId::WinLevel,
+            SoundId::FloorMovementAnimation
+        };
+    }
+    case ControllerId::MainMenu:
+    case ControllerId::SerieMainMenu:
+    case ControllerId::OfficialSeriesMenu:
+    case ControllerId::EditorMenu:
+    {
+        return {
+            SoundId::ScreenTransition,
+            SoundId::MoveSelector
+        };
+    }
+    default:
+    {
+        break;
+    }
+    }
+
+    return {SoundId::ScreenTransition};
+}
+
 class SoundsManager::Impl
 {
 
 public:
 
-    sounds::Sound moveSelectorSound {"001"};
-    sounds::Sound screenTransitionSound {"002"};
-    sounds::Sound hideLevelSound {"003"};
-    sounds::Sound foundStarSound {"004"};
-    sounds::Sound foundLifeOrTimeSound {"005"};
-    sounds::Sound foundDeadOrLessTimeSound {"006"};
-    sounds::Sound collisionSound {"007"};
-    sounds::Sound floorSwitchSound {"008"};
-    sounds::Sound timeOverSound {"009"};
-    sounds::Sound mirrorAnimationSound {"010"};
-    sounds::Sound winLevelSound {"011"};
-    sounds::Sound floorMovementAnimationSound {"012"};
+    Impl(const utils::ResourcesLoader& loader) :
+        mixer(loader)
+    {
+    }
+
+    sounds::AudioMixer mixer;
 };
 
 /**
  *
  */
-SoundsManager::SoundsManager() : impl(std::make_unique<Impl>())
+SoundsManager::SoundsManager(const utils::ResourcesLoader& loader) :
+    impl(std::make_unique<Impl>(loader))
 {
 }
 
@@ -65,12 +117,22 @@ SoundsManager::SoundsManager() : impl(std::make_unique<Impl>())
  */
 SoundsManager::~SoundsManager() = default;
 
+/**
+ *
+ */
+void SoundsManager::preloadControllerSounds(
+    const controllers::ControllerId& id
+) const &
+{
+    impl->mixer.preload(getControllerSounds(id));
+}
+
 /**
  *
  */
 void SoundsManager::playMoveSelectorSound() const &
 {
-    impl->moveSelectorSound.play();
+    impl->mixer.play(sounds::SoundId::MoveSelector);
 }
 
 /**
@@ -78,7 +140,7 @@ void SoundsManager::playMoveSelectorSound() const &
  */
 void SoundsManager::playScreenTransitionSound() const &
 {
-    impl->screenTransitionSound.play();
+    impl->mixer.play(sounds::SoundId::ScreenTransition);
 }
 
 /**
@@ -86,7 +148,7 @@ void SoundsManager::playScreenTransitionSound() const &
  */
 void SoundsManager::playHideLevelSound() const &
 {
-    impl->hideLevelSound.play();
+    impl->mixer.play(sounds::SoundId::HideLevel);
 }
 
 /**
@@ -94,7 +156,7 @@ void SoundsManager::playHideLevelSound() const &
  */
 void SoundsManager::playFoundStarSound() const &
 {
-    impl->foundStarSound.play();
+    impl->mixer.play(sounds::SoundId::FoundStar);
 }
 
 /**
@@ -102,7 +164,7 @@ void SoundsManager::playFoundStarSound() const &
  */
 void SoundsManager::playFoundLifeOrTimeSound() const &
 {
-    impl->foundLifeOrTimeSound.play();
+    impl->mixer.play(sounds::SoundId::FoundLifeOrTime);
 }
 
 /**
@@ -110,7 +172,7 @@ void SoundsManager::playFoundLifeOrTimeSound() const &
  */
 void SoundsManager::playFoundDeadOrLessTimeSound() const &
 {
-    impl->foundDeadOrLessTimeSound.play();
+    impl->mixer.play(sounds::SoundId::FoundDeadOrLessTime);
 }
 
 /**
@@ -118,7 +180,7 @@ void SoundsManager::playFoundDeadOrLessTimeSound() const &
  */
 void SoundsManager::playCollisionSound() const &
 {
-    impl->collisionSound.play();
+    impl->mixer.play(sounds::SoundId::Collision);
 }
 
 /**
@@ -126,7 +188,7 @@ void SoundsManager::playCollisionSound() const &
  */
 void SoundsManager::playFloorSwitchSound() const &
 {
-    impl->floorSwitchSound.play();
+    impl->mixer.play(sounds::SoundId::FloorSwitch);
 }
 
 /**
@@ -134,7 +196,7 @@ void SoundsManager::playFloorSwitchSound() const &
  */
 void SoundsManager::playTimeOverSound() const &
 {
-    impl->timeOverSound.play();
+    impl->mixer.play(sounds::SoundId::TimeOver);
 }
 
 /**
@@ -142,7 +204,7 @@ void SoundsManager::playTimeOverSound() const &
  */
 void SoundsManager::playMirrorAnimationSound() const &
 {
-    impl->mirrorAnimationSound.play();
+    impl->mixer.play(sounds::SoundId::MirrorAnimation);
 }
 
 /**
@@ -150,7 +212,7 @@ void SoundsManager::playMirrorAnimationSound() const &
  */
 void SoundsManager::playWinLevelSound() const &
 {
-    impl->winLevelSound.play();
+    impl->mixer.play(sounds::SoundId::WinLevel);
 }
 
 /**
@@ -158,7 +220,7 @@ void SoundsManager::playWinLevelSound() const &
  */
 void SoundsManager::playFloorMovementAnimationSound() const &
 {
-    impl->floorMovementAnimationSound.play();
+    impl->mixer.play(sounds::SoundId::FloorMovementAnimation);
 }
 
 }
@@ -25,7 +25,6 @@
 #include "StairsAnimation.hpp"
 
 #include "SoundsManager.hpp"
-#include "Cell.hpp"
 #include "Level.hpp"
 #include "Context.hpp"
 
@@ -35,6 +34,7 @@ namespace animations
 {
 
 constexpr float TRANSPARENCY_UPDATE_AMOUNT {17.f};
+constexpr sf::Int32 ANIMATION_STEPS_INTERVAL {50};
 
 class StairsAnimation::Impl
 {
@@ -72,15 +72,12 @@ StairsAnimation::StairsAnimation(
     LevelAnimation(
         context,
         level,
-        floor
+        floor,
+        ANIMATION_STEPS_INTERVAL,
+        FirstStep::Delayed
     ),
     impl(std::make_unique<Impl>(direction))
 {
-    /* this animation is a simple waiting period; in order to wait the
-       appropriated time, we just save the current time once before the
-       waiting period; if the animation just started, the last animation
-       update time is equal to 0 */
-    setAnimationLastUpdateTime(context.getClockMillisecondsTime());
 }
 
 /**
@@ -93,25 +90,19 @@ StairsAnimation::~StairsAnimation() = default;
  */
 void StairsAnimation::renderAnimation() &
 {
-    const auto& context = getContext();
     const auto& level = getLevel();
     const auto& floor = getFloor();
 
     level->display(floor + impl->transformation);
 
-    auto& lastUpdateTime = getAnimationLastUpdateTime();
-
-    const auto& currentTime = context.getClockMillisecondsTime();
-
-    constexpr sf::Uint32 ANIMATION_INTERVAL {50};
-    if (currentTime - lastUpdateTime < ANIMATION_INTERVAL)
+    for (
+        auto steps = getElapsedAnimationSteps();
+        steps != 0 and not isFinished();
+        steps -= 1
+    )
     {
-        return;
+        playNextAnimationStep();
     }
-
-    playNextAnimationStep();
-
-    setAnimationLastUpdateTime(currentTime);
 }
 
 /**
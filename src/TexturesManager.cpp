@@ -1,4 +1,4 @@
-/**
+/*
  * Memoris
  * Copyright (C) 2017  Jean LELIEVRE
  *
@@ -15,7 +15,6 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
-
 /**
  * @file TexturesManager.cpp
  * @package textures
@@ -24,58 +23,184 @@
 
 #include "TexturesManager.hpp"
 
+#include "ResourcesLoader.hpp"
+#include "controllers_ids.hpp"
+
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Image.hpp>
 
+#include <algorithm>
+#include <array>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace memoris
 {
 namespace managers
 {
 
+using TextureId = TexturesManager::TextureId;
+
+/* the pictures of the images folder, in the order of the textures ids */
+constexpr const char* TEXTURES_PICTURES[] {
+    "star",
+    "life",
+    "target",
+    "timer",
+    "floor",
+    "new",
+    "open",
+    "save",
+    "cursor",
+    "exit",
+    "test",
+    "up",
+    "down",
+    "scroll_down",
+    "scroll_up"
+};
+
+constexpr std::size_t TEXTURES_AMOUNT {
+    sizeof(TEXTURES_PICTURES) / sizeof(const char*)
+};
+
+static_assert(
+    static_cast<std::size_t>(TextureId::ScrollArrowUp) + 1 == TEXTURES_AMOUNT,
+    "every texture id must have one picture"
+);
+
+/**
+ * @brief returns the path of the picture of the given texture into the
+ * resources pack
+ *
+ * @param id the texture id
+ *
+ * @return std::string
+ */
+std::string getTexturePicturePath(const TextureId& id)
+{
+    return std::string("images/") +
+        TEXTURES_PICTURES[static_cast<std::size_t>(id)] + ".png";
+}
+
+/**
+ * @brief returns the textures used by the given controller, so they can be
+ * loaded together before the controller creation
+ *
+ * @param id the controller id
+ *
+ * @return std::vector<TextureId>
+ */
+std::vector<TextureId> getControllerTextures(
+    const controllers::ControllerId& id
+)
+{
+    using controllers::ControllerId;
+
+    switch(id)
+    {
+    case ControllerId::Game:
+    {
+        return {
+            TextureId::Star,
+            TextureId::Life,
+            TextureId::Target,
+            TextureId::Time,
+            TextureId::Floor
+        };
+    }
+    case ControllerId::LevelEditor:
+    {
+        return {
+            TextureId::Cursor,
+            TextureId::New,
+            TextureId::Save,
+            TextureId::Exit,
+            TextureId::Test,
+            TextureId::ArrowUp,
+            TextureId::ArrowDown
+        };
+    }
+    case ControllerId::SerieEditor:
+    {
+        return {
+            TextureId::Cursor,
+            TextureId::New,
+            TextureId::Save,
+            TextureId::Exit,
+            TextureId::ScrollArrowUp,
+            TextureId::ScrollArrowDown
+        };
+    }
+    case ControllerId::OpenGame:
+    case ControllerId::PersonalSeriesMenu:
+    {
+        return {
+            TextureId::Cursor,
+            TextureId::ScrollArrowUp,
+            TextureId::ScrollArrowDown
+        };
+    }
+    default:
+    {
+        break;
+    }
+    }
+
+    return {};
+}
+
+/**
+ * @brief creates a texture from a decoded picture; this function uses the
+ * graphic card, so it must be called from the main thread
+ *
+ * @param picture the decoded picture
+ * @param id the texture id
+ *
+ * @return TextureHandle
+ *
+ * @throw std::invalid_argument the texture cannot be created
+ */
+TextureHandle createTexture(
+    const sf::Image& picture,
+    const TextureId& id
+)
+{
+    auto texture = std::make_shared<sf::Texture>();
+
+    if (!texture->loadFromImage(picture))
+    {
+        throw std::invalid_argument(
+            "Cannot load texture : " + getTexturePicturePath(id)
+        );
+    }
+
+    return texture;
+}
+
 class TexturesManager::Impl
 {
 
 public:
 
-    sf::Texture cursorTexture;
-    sf::Texture starTexture;
-    sf::Texture lifeTexture;
-    sf::Texture targetTexture;
-    sf::Texture timeTexture;
-    sf::Texture floorTexture;
-    sf::Texture newTexture;
-    sf::Texture openTexture;
-    sf::Texture saveTexture;
-    sf::Texture exitTexture;
-    sf::Texture testTexture;
-    sf::Texture arrowUpTexture;
-    sf::Texture arrowDownTexture;
-    sf::Texture scrollArrowDownTexture;
-    sf::Texture scrollArrowUpTexture;
+    Impl(const utils::ResourcesLoader& loader) :
+        loader(loader)
+    {
+    }
+
+    const utils::ResourcesLoader& loader;
+
+    /* a texture is only owned by the manager when its use count is 1 */
+    std::array<TextureHandle, TEXTURES_AMOUNT> textures;
 };
 
 /**
  *
  */
-TexturesManager::TexturesManager() :
-    impl(std::make_unique<Impl>())
+TexturesManager::TexturesManager(const utils::ResourcesLoader& loader) :
+    impl(std::make_unique<Impl>(loader))
 {
-    loadTexture(impl->starTexture, "star");
-    loadTexture(impl->lifeTexture, "life");
-    loadTexture(impl->targetTexture, "target");
-    loadTexture(impl->timeTexture, "timer");
-    loadTexture(impl->floorTexture, "floor");
-    loadTexture(impl->newTexture, "new");
-    loadTexture(impl->openTexture, "open");
-    loadTexture(impl->saveTexture, "save");
-    loadTexture(impl->cursorTexture, "cursor");
-    loadTexture(impl->exitTexture, "exit");
-    loadTexture(impl->testTexture, "test");
-    loadTexture(impl->arrowUpTexture, "up");
-    loadTexture(impl->arrowDownTexture, "down");
-    loadTexture(impl->scrollArrowDownTexture, "scroll_down");
-    loadTexture(impl->scrollArrowUpTexture, "scroll_up");
 }
 
 /**
@@ -86,136 +211,208 @@ TexturesManager::~TexturesManager() = default;
 /**
  *
  */
-const sf::Texture& TexturesManager::getStarTexture() const & noexcept
+void TexturesManager::preloadControllerTextures(
+    const controllers::ControllerId& id
+) const &
+{
+    const auto expectedTextures = getControllerTextures(id);
+
+    auto& textures = impl->textures;
+
+    std::vector<TextureId> missingTextures;
+    std::vector<std::string> missingPictures;
+
+    for (
+        std::size_t index {0};
+        index < TEXTURES_AMOUNT;
+        index += 1
+    )
+    {
+        const auto textureId = static_cast<TextureId>(index);
+        auto& texture = textures[index];
+
+        const bool expected = std::find(
+            expectedTextures.cbegin(),
+            expectedTextures.cend(),
+            textureId
+        ) != expectedTextures.cend();
+
+        if (not expected)
+        {
+            if (texture.use_count() == 1)
+            {
+                texture.reset();
+            }
+
+            continue;
+        }
+
+        if (texture == nullptr)
+        {
+            missingTextures.push_back(textureId);
+            missingPictures.push_back(getTexturePicturePath(textureId));
+        }
+    }
+
+    const auto pictures = impl->loader.decodePictures(missingPictures);
+
+    for (
+        std::size_t index {0};
+        index < missingTextures.size();
+        index += 1
+    )
+    {
+        const auto& textureId = missingTextures[index];
+
+        textures[static_cast<std::size_t>(textureId)] = createTexture(
+            pictures[index],
+            textureId
+        );
+    }
+}
+
+/**
+ *
+ */
+TextureHandle TexturesManager::getStarTexture() const &
 {
-    return impl->starTexture;
+    return getTexture(TextureId::Star);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getLifeTexture() const & noexcept
+TextureHandle TexturesManager::getLifeTexture() const &
 {
-    return impl->lifeTexture;
+    return getTexture(TextureId::Life);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getTargetTexture() const & noexcept
+TextureHandle TexturesManager::getTargetTexture() const &
 {
-    return impl->targetTexture;
+    return getTexture(TextureId::Target);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getTimeTexture() const & noexcept
+TextureHandle TexturesManager::getTimeTexture() const &
 {
-    return impl->timeTexture;
+    return getTexture(TextureId::Time);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getFloorTexture() const & noexcept
+TextureHandle TexturesManager::getFloorTexture() const &
 {
-    return impl->floorTexture;
+    return getTexture(TextureId::Floor);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getNewTexture() const & noexcept
+TextureHandle TexturesManager::getNewTexture() const &
 {
-    return impl->newTexture;
+    return getTexture(TextureId::New);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getOpenTexture() const & noexcept
+TextureHandle TexturesManager::getOpenTexture() const &
 {
-    return impl->openTexture;
+    return getTexture(TextureId::Open);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getSaveTexture() const & noexcept
+TextureHandle TexturesManager::getSaveTexture() const &
 {
-    return impl->saveTexture;
+    return getTexture(TextureId::Save);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getCursorTexture() const & noexcept
+TextureHandle TexturesManager::getCursorTexture() const &
 {
-    return impl->cursorTexture;
+    return getTexture(TextureId::Cursor);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getExitTexture() const & noexcept
+TextureHandle TexturesManager::getExitTexture() const &
 {
-    return impl->exitTexture;
+    return getTexture(TextureId::Exit);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getTestTexture() const & noexcept
+TextureHandle TexturesManager::getTestTexture() const &
 {
-    return impl->testTexture;
+    return getTexture(TextureId::Test);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getArrowUpTexture() const & noexcept
+TextureHandle TexturesManager::getArrowUpTexture() const &
 {
-    return impl->arrowUpTexture;
+    return getTexture(TextureId::ArrowUp);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getArrowDownTexture() const & noexcept
+TextureHandle TexturesManager::getArrowDownTexture() const &
 {
-    return impl->arrowDownTexture;
+    return getTexture(TextureId::ArrowDown);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getScrollArrowDownTexture() const &
-    noexcept
+TextureHandle TexturesManager::getScrollArrowDownTexture() const &
 {
-    return impl->scrollArrowDownTexture;
+    return getTexture(TextureId::ScrollArrowDown);
 }
 
 /**
  *
  */
-const sf::Texture& TexturesManager::getScrollArrowUpTexture() const & noexcept
+TextureHandle TexturesManager::getScrollArrowUpTexture() const &
 {
-    return impl->scrollArrowUpTexture;
+    return getTexture(TextureId::ScrollArrowUp);
 }
 
 /**
  *
  */
-void TexturesManager::loadTexture(
-    sf::Texture& texture,
-    const std::string& path
-) &
+TextureHandle TexturesManager::getTexture(
+    const TextureId& id
+) const &
 {
-    if (!texture.loadFromFile("res/images/" + path + ".png"))
+    auto& texture = impl->textures[static_cast<std::size_t>(id)];
+
+    if (texture == nullptr)
     {
-        throw std::invalid_argument("Cannot load texture : " + path);
+        const auto pictures = impl->loader.decodePictures(
+            {getTexturePicturePath(id)}
+        );
+
+        texture = createTexture(
+            pictures.front(),
+            id
+        );
     }
+
+    return texture;
 }
 
 }
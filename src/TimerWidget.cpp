@@ -28,15 +28,17 @@
 #include "Context.hpp"
 #include "FontsManager.hpp"
 #include "ColorsManager.hpp"
-
-#include <SFML/Graphics/Text.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
+#include "ProfiledWindow.hpp"
+#include "DigitsText.hpp"
 
 namespace memoris
 {
 namespace widgets
 {
 
+/* 'mm : ss' */
+constexpr unsigned short CLOCK_CHARACTERS {7};
+
 class TimerWidget::Impl
 {
 
@@ -48,12 +50,14 @@ public:
         const unsigned short& seconds
     ) :
         window(context.getSfmlWindow()),
+        text(
+            context.getFontsManager().getTextDigitsStrip(sizes::TEXT_SIZE),
+            CLOCK_CHARACTERS
+        ),
         minutes(minutes),
         seconds(seconds)
     {
-        text.setFont(context.getFontsManager().getTextFont());
-        text.setCharacterSize(sizes::TEXT_SIZE);
-        text.setFillColor(context.getColorsManager().getColorWhite());
+        text.setColor(context.getColorsManager().getColorWhite());
 
         constexpr float WIDGET_HORIZONTAL_POSITION {295.f};
         constexpr float WIDGET_VERTICAL_POSITION {10.f};
@@ -63,11 +67,11 @@ public:
         );
     }
 
-    sf::RenderWindow& window;
+    utils::ProfiledWindow& window;
 
     sf::Uint32 lastTimerUpdateTime {0};
 
-    sf::Text text;
+    DigitsText text;
 
     unsigned short minutes;
     unsigned short seconds;
@@ -104,7 +108,7 @@ TimerWidget::~TimerWidget() = default;
  */
 void TimerWidget::display() const &
 {
-    impl->window.draw(impl->text);
+    impl->text.display(impl->window);
 }
 
 /**
@@ -142,33 +146,20 @@ const bool TimerWidget::isTimeOver() const & noexcept
 /**
  *
  */
-void TimerWidget::updateDisplayedString() const &
+void TimerWidget::updateDisplayedString() const & noexcept
 {
-    auto& seconds = impl->seconds;
-    auto& minutes = impl->minutes;
-
-    /* conversion of the numeric values
-       to std::string and then to sf::String */
-    sf::String secondsString = std::to_string(seconds);
-    sf::String minutesString = std::to_string(minutes);
-
-    if (seconds < 10)
-    {
-        secondsString.insert(0, "0");
-    }
-
-    if (minutes < 10)
-    {
-        minutesString.insert(0, "0");
-    }
+    impl->text.setClock(
+        impl->minutes,
+        impl->seconds
+    );
 
-    impl->text.setString(minutesString + " : " + secondsString);
+    impl->window.invalidate();
 }
 
 /**
  *
  */
-void TimerWidget::decrementPlayingTimer() const &
+void TimerWidget::decrementPlayingTimer() const & noexcept
 {
     auto& started = impl->started;
     auto& seconds = impl->seconds;
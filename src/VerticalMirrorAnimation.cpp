@@ -27,11 +27,11 @@
 #include "SoundsManager.hpp"
 #include "ShapesManager.hpp"
 #include "Level.hpp"
-#include "Cell.hpp"
 #include "dimensions.hpp"
+#include "floor_permutations.hpp"
 #include "Context.hpp"
+#include "ProfiledWindow.hpp"
 
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 
 namespace memoris
@@ -41,7 +41,6 @@ namespace animations
 
 constexpr unsigned short CELLS_PER_LINE_PER_SIDE {8};
 constexpr unsigned short LEFT_SIDE_LAST_CELL_INDEX {247};
-constexpr unsigned short LINE_LAST_CELL_INDEX {15};
 
 /**
  *
@@ -64,20 +63,32 @@ VerticalMirrorAnimation::VerticalMirrorAnimation(
  */
 void VerticalMirrorAnimation::renderAnimation() &
 {
-    const auto& context = getContext();
-    const auto& level = getLevel();
-
-    constexpr sf::Uint32 ANIMATION_STEPS_INTERVAL {50};
-    if (
-        context.getClockMillisecondsTime() -
-        getAnimationLastUpdateTime() < ANIMATION_STEPS_INTERVAL
+    for (
+        auto steps = getElapsedAnimationSteps();
+        steps != 0 and not isFinished();
+        steps -= 1
     )
     {
-        displayLevelAndVerticalSeparator();
+        startTransparencyStep();
 
-        return;
+        playNextAnimationStep();
+
+        incrementAnimationStep();
     }
 
+    interpolateTransparency();
+
+    displayLevelAndVerticalSeparator();
+}
+
+/**
+ *
+ */
+void VerticalMirrorAnimation::playNextAnimationStep() const &
+{
+    const auto& context = getContext();
+    const auto& level = getLevel();
+
     const auto animationSteps = getAnimationSteps();
 
     if (animationSteps == 0)
@@ -126,14 +137,10 @@ void VerticalMirrorAnimation::renderAnimation() &
     {
         const auto updatedPlayerIndex = getUpdatedPlayerIndex();
         level->setPlayerCellIndex(updatedPlayerIndex);
-        level->getCells()[updatedPlayerIndex]->show(context);
+        level->showCell(updatedPlayerIndex);
 
         endsAnimation();
     }
-
-    displayLevelAndVerticalSeparator();
-
-    incrementAnimationStep();
 }
 
 /**
@@ -141,79 +148,10 @@ void VerticalMirrorAnimation::renderAnimation() &
  */
 void VerticalMirrorAnimation::invertSides() const &
 {
-    const unsigned short firstIndex = getFloor() * dimensions::CELLS_PER_FLOOR;
-
-    constexpr unsigned short LAST_FLOOR_CELL_INDEX {255};
-    const unsigned short lastIndex = firstIndex + LAST_FLOOR_CELL_INDEX;
-
-    const auto& level = getLevel();
-    const unsigned short previousPlayerCell = level->getPlayerCellIndex();
-
-    unsigned short line {0};
-
-    for (
-        unsigned short index = firstIndex;
-        index < lastIndex;
-        index += 1
-    )
-    {
-        if (index % dimensions::CELLS_PER_LINE >= CELLS_PER_LINE_PER_SIDE)
-        {
-            continue;
-        }
-
-        const char type = level->getCells()[index]->getType();
-        const bool visible = level->getCells()[index]->isVisible();
-        const unsigned short invertedIndex =
-            findInvertedIndex(
-                line,
-                index
-            );
-
-        level->getCells()[index]->setType(
-            level->getCells()[invertedIndex]->getType()
-        );
-
-        showOrHideCell(
-            index,
-            level->getCells()[invertedIndex]->isVisible()
-        );
-
-        level->getCells()[invertedIndex]->setType(type);
-
-        showOrHideCell(
-            invertedIndex,
-            visible
-        );
-
-        if (previousPlayerCell == index)
-        {
-            setUpdatedPlayerIndex(
-                findInvertedIndex(
-                    line,
-                    index
-                )
-            );
-        } else if (
-            previousPlayerCell ==
-                findInvertedIndex(
-                    line,
-                    index
-                )
-        )
-        {
-            setUpdatedPlayerIndex(index);
-        }
-
-        constexpr unsigned short CELLS_PER_LINE_OFFSET {7};
-        if (
-            index and
-            (index - CELLS_PER_LINE_OFFSET) % CELLS_PER_LINE_PER_SIDE == 0
-        )
-        {
-            line += 1;
-        }
-    }
+    permuteFloorCells(
+        getFloor(),
+        game::getFloorPermutation(game::Transformation::VerticalMirror)
+    );
 }
 
 /**
@@ -272,17 +210,5 @@ void VerticalMirrorAnimation::displayLevelAndVerticalSeparator() const &
     );
 }
 
-/**
- *
- */
-const unsigned short VerticalMirrorAnimation::findInvertedIndex(
-    const unsigned short& line,
-    const unsigned short& index
-) const & noexcept
-{
-    return dimensions::CELLS_PER_LINE * line +
-        (LINE_LAST_CELL_INDEX - index % dimensions::CELLS_PER_LINE);
-}
-
 }
 }
@@ -28,9 +28,8 @@
 #include "ColorsManager.hpp"
 #include "Context.hpp"
 #include "window.hpp"
-
-#include <SFML/Graphics/Text.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
+#include "ProfiledWindow.hpp"
+#include "DigitsText.hpp"
 
 namespace memoris
 {
@@ -38,6 +37,10 @@ namespace widgets
 {
 
 constexpr float TIMERS_VERTICAL_POSITION {300.f};
+constexpr unsigned int TIMER_SIZE {140};
+
+/* enough characters for any unsigned short value */
+constexpr unsigned short TIMER_MAXIMUM_DIGITS {5};
 
 class WatchingTimer::Impl
 {
@@ -48,37 +51,37 @@ public:
         const utils::Context& context,
         const unsigned short& displayedTime
     ) :
+        left(
+            context.getFontsManager().getTextDigitsStrip(TIMER_SIZE),
+            TIMER_MAXIMUM_DIGITS
+        ),
+        right(
+            context.getFontsManager().getTextDigitsStrip(TIMER_SIZE),
+            TIMER_MAXIMUM_DIGITS
+        ),
         displayedTime(displayedTime),
         originalTime(displayedTime),
         context(context)
     {
-        const auto time = std::to_string(displayedTime);
-
         constexpr float LEFT_TIMER_HORIZONTAL_POSITION {90.f};
-        left.setString(time);
-        left.setFont(context.getFontsManager().getTextFont());
-        left.setFillColor(context.getColorsManager().getColorWhite());
+        left.setNumber(displayedTime);
+        left.setColor(context.getColorsManager().getColorWhite());
         left.setPosition(
             LEFT_TIMER_HORIZONTAL_POSITION,
             TIMERS_VERTICAL_POSITION
         );
 
         constexpr float RIGHT_TIMER_HORIZONTAL_POSITION {1400.f};
-        right.setString(time);
-        right.setFont(context.getFontsManager().getTextFont());
-        right.setFillColor(context.getColorsManager().getColorWhite());
+        right.setNumber(displayedTime);
+        right.setColor(context.getColorsManager().getColorWhite());
         right.setPosition(
             RIGHT_TIMER_HORIZONTAL_POSITION,
             TIMERS_VERTICAL_POSITION
         );
-
-        constexpr unsigned int TIMER_SIZE {140};
-        left.setCharacterSize(TIMER_SIZE);
-        right.setCharacterSize(TIMER_SIZE);
     }
 
-    sf::Text left;
-    sf::Text right;
+    DigitsText left;
+    DigitsText right;
 
     unsigned short displayedTime;
     unsigned short originalTime;
@@ -113,29 +116,27 @@ WatchingTimer::~WatchingTimer() = default;
 void WatchingTimer::display() const &
 {
     auto& window = impl->context.getSfmlWindow();
-    window.draw(impl->left);
-    window.draw(impl->right);
+    impl->left.display(window);
+    impl->right.display(window);
 }
 
 /**
  *
  */
-void WatchingTimer::decrementWatchingTimer() const &
+void WatchingTimer::decrementWatchingTimer() const & noexcept
 {
     impl->displayedTime -= 1;
 
-    const auto time = std::to_string(impl->displayedTime);
-
     auto& left = impl->left;
     auto& right = impl->right;
 
-    left.setString(time);
-    right.setString(time);
+    left.setNumber(impl->displayedTime);
+    right.setNumber(impl->displayedTime);
 
     constexpr float LEFT_SEPARATOR_POSITION {290.f};
     constexpr float LEFT_AREA_CENTER {LEFT_SEPARATOR_POSITION / 2};
     left.setPosition(
-        LEFT_AREA_CENTER - left.getLocalBounds().width / 2,
+        LEFT_AREA_CENTER - left.getWidth() / 2,
         TIMERS_VERTICAL_POSITION
     );
 
@@ -146,9 +147,11 @@ void WatchingTimer::decrementWatchingTimer() const &
         ) / 2
     };
     right.setPosition(
-        RIGHT_AREA_CENTER - right.getLocalBounds().width / 2,
+        RIGHT_AREA_CENTER - right.getWidth() / 2,
         TIMERS_VERTICAL_POSITION
     );
+
+    impl->context.getSfmlWindow().invalidate();
 }
 
 /**
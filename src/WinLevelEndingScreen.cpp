@@ -29,8 +29,8 @@
 #include "ColorsManager.hpp"
 #include "PlayingSerieManager.hpp"
 #include "window.hpp"
+#include "ProfiledWindow.hpp"
 
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 
@@ -33,8 +33,9 @@
 #include "AnimatedBackground.hpp"
 #include "HorizontalGradient.hpp"
 #include "PlayingSerieManager.hpp"
+#include "ProfiledWindow.hpp"
+#include "ContentCatalog.hpp"
 
-#include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Window/Event.hpp>
 
@@ -181,30 +182,25 @@ const ControllerId& WinSerieEndingController::render() const &
  */
 inline void WinSerieEndingController::unlockNextSerieFromGameFile() const &
 {
-    /* we cannot read, clear, write a file, the only solution
-       is to first open it for reading and then open it again
-       for clear its content and write into it */
-
-    const std::string fileName = GAMES_FILES_DIRECTORY +
-        getContext().getGameName() +
-        GAMES_FILES_EXTENSION;
-
-    std::fstream file;
-    file.open(
-        fileName,
-        std::ios::in
-    );
+    /* the current content of the game file is indexed by the catalog,
+       the file is only opened to be overwritten; the catalog is notified
+       when the file is closed */
+
+    const auto& context = getContext();
+    const auto& gameName = context.getGameName();
 
-    char serieCharacter;
-    file.get(serieCharacter);
-    file.close();
+    const auto game = context.getContentCatalog().getEntry(
+        managers::ContentDirectory::Games,
+        gameName
+    );
 
-    unsigned short lastUnlockedSerie = serieCharacter - '0';
+    unsigned short lastUnlockedSerie =
+        game == nullptr ? 0 : game->lastUnlockedSerie;
     lastUnlockedSerie += 1;
 
-    file.open(
-        fileName,
-        std::ios::trunc | std::ios::out
+    std::ofstream file(
+        GAMES_FILES_DIRECTORY + gameName + GAMES_FILES_EXTENSION,
+        std::ios::trunc
     );
     file << lastUnlockedSerie;
 }
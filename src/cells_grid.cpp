@@ -0,0 +1,101 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file cells_grid.cpp
+ * @package utils
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "cells_grid.hpp"
+
+#include <SFML/Window/Mouse.hpp>
+#include <SFML/Graphics/Transform.hpp>
+
+namespace memoris
+{
+namespace utils
+{
+
+constexpr float CELLS_PITCH {50.f};
+constexpr float CELL_DIMENSION {49.f};
+
+/**
+ *
+ */
+sf::Vector2<float> getCursorPosition(const sf::Transform* transform)
+{
+    const auto cursorPosition = sf::Mouse::getPosition();
+
+    const sf::Vector2<float> position(
+        static_cast<float>(cursorPosition.x),
+        static_cast<float>(cursorPosition.y)
+    );
+
+    if (transform == nullptr)
+    {
+        return position;
+    }
+
+    return transform->getInverse().transformPoint(position);
+}
+
+/**
+ *
+ */
+const short getGridCellIndex(
+    const CellsGrid& grid,
+    const sf::Vector2<float>& position
+) noexcept
+{
+    const float horizontal = position.x - grid.left;
+    const float vertical = position.y - grid.top;
+
+    if (horizontal < 0.f or vertical < 0.f)
+    {
+        return NO_GRID_CELL;
+    }
+
+    const auto column = static_cast<unsigned int>(horizontal / CELLS_PITCH);
+    const auto line = static_cast<unsigned int>(vertical / CELLS_PITCH);
+
+    if (column >= grid.columns or line >= grid.rows)
+    {
+        return NO_GRID_CELL;
+    }
+
+    /* the borders are excluded, as the previous per cell bounding box
+       tests did: the cell is hover strictly inside its 49 pixels */
+    const float cellHorizontal = horizontal - column * CELLS_PITCH;
+    const float cellVertical = vertical - line * CELLS_PITCH;
+
+    if (
+        cellHorizontal <= 0.f or
+        cellHorizontal >= CELL_DIMENSION or
+        cellVertical <= 0.f or
+        cellVertical >= CELL_DIMENSION
+    )
+    {
+        return NO_GRID_CELL;
+    }
+
+    return static_cast<short>(line * grid.columns + column);
+}
+
+}
+}
@@ -40,6 +40,8 @@
 #include "PersonalSeriesMenuController.hpp"
 #include "Context.hpp"
 #include "ErrorController.hpp"
+#include "level_files.hpp"
+#include "replays.hpp"
 
 #include <SFML/System/String.hpp>
 
@@ -82,6 +84,33 @@ std::unique_ptr<Controller> getControllerById(
 
             const auto& serieManager = context.getPlayingSerieManager();
 
+            if (not context.getReplayFilePath().empty())
+            {
+                /* the replay is played only once, the next games
+                   are played normally */
+                const auto path = context.getReplayFilePath();
+                context.setReplayFilePath("");
+
+                const auto replay =
+                    std::make_shared<const replays::Replay>(
+                        replays::loadReplayFile(path)
+                    );
+
+                serieManager.reinitialize();
+                serieManager.setLifesAmount(replay->lifes);
+                serieManager.setWatchingTime(replay->watchingTime);
+
+                return std::make_unique<GameController>(
+                    context,
+                    std::make_shared<entities::Level>(
+                        context,
+                        replay->level
+                    ),
+                    replay->displayedWatchingTime,
+                    replay
+                );
+            }
+
             if (editedLevel != nullptr)
             {
                 serieManager.reinitialize();
@@ -92,13 +121,11 @@ std::unique_ptr<Controller> getControllerById(
                 );
             }
 
-            std::string levelPath = "data/levels/" +
-                serieManager.getSerieTypeAsString() + "/" +
-                serieManager.getNextLevelName() + ".level";
-
+            /* the level is usually already loaded in background
+               by the serie manager */
             const auto level = std::make_shared<entities::Level>(
                 context,
-                levelPath
+                serieManager.getNextLevel()
             );
 
             return std::make_unique<GameController>(
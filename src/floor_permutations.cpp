@@ -0,0 +1,127 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file floor_permutations.cpp
+ * @package game
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "floor_permutations.hpp"
+
+namespace memoris
+{
+namespace game
+{
+
+namespace
+{
+
+/* indexed by the transformations values */
+constexpr FloorPermutation TRANSFORMATIONS_PERMUTATIONS[] {
+    createFloorPermutation(Transformation::HorizontalMirror),
+    createFloorPermutation(Transformation::VerticalMirror),
+    createFloorPermutation(Transformation::Diagonal),
+    createFloorPermutation(Transformation::LeftRotation),
+    createFloorPermutation(Transformation::RightRotation)
+};
+
+/* indexed by the quarters swaps values */
+constexpr FloorPermutation SWAPS_PERMUTATIONS[] {
+    createFloorPermutation(QuartersSwap::TopLeftWithBottomRight),
+    createFloorPermutation(QuartersSwap::TopRightWithBottomLeft)
+};
+
+/**
+ * @brief returns true if the second permutation brings back every cell
+ * moved by the first permutation
+ *
+ * @param first the first applied permutation
+ * @param second the second applied permutation
+ *
+ * @return bool
+ */
+constexpr bool isInversePermutation(
+    const FloorPermutation& first,
+    const FloorPermutation& second
+) noexcept
+{
+    for (
+        unsigned short index {0};
+        index < dimensions::CELLS_PER_FLOOR;
+        index += 1
+    )
+    {
+        if (second[first[index]] != index)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static_assert(
+    isInversePermutation(
+        TRANSFORMATIONS_PERMUTATIONS[
+            static_cast<unsigned char>(Transformation::LeftRotation)
+        ],
+        TRANSFORMATIONS_PERMUTATIONS[
+            static_cast<unsigned char>(Transformation::RightRotation)
+        ]
+    ),
+    "the left rotation must be the inverse of the right rotation"
+);
+
+static_assert(
+    isInversePermutation(
+        TRANSFORMATIONS_PERMUTATIONS[
+            static_cast<unsigned char>(Transformation::HorizontalMirror)
+        ],
+        TRANSFORMATIONS_PERMUTATIONS[
+            static_cast<unsigned char>(Transformation::HorizontalMirror)
+        ]
+    ),
+    "the horizontal mirror must be its own inverse"
+);
+
+}
+
+/**
+ *
+ */
+const FloorPermutation& getFloorPermutation(
+    const Transformation& transformation
+) noexcept
+{
+    return TRANSFORMATIONS_PERMUTATIONS[
+        static_cast<unsigned char>(transformation)
+    ];
+}
+
+/**
+ *
+ */
+const FloorPermutation& getFloorPermutation(const QuartersSwap& swap)
+    noexcept
+{
+    return SWAPS_PERMUTATIONS[static_cast<unsigned char>(swap)];
+}
+
+}
+}
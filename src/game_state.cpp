@@ -0,0 +1,429 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file game_state.cpp
+ * @package game
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "game_state.hpp"
+
+#include "level_files.hpp"
+#include "cells.hpp"
+
+#include <algorithm>
+
+namespace memoris
+{
+namespace game
+{
+
+constexpr unsigned short MINIMUM_WATCHING_TIME {3};
+constexpr unsigned short WATCHING_TIME_UPDATE_STEP {3};
+
+/**
+ * @brief applies the given transformation on one floor of the level and
+ * moves the player with the cells if the player is on this floor
+ *
+ * @param state the game state to update
+ * @param transformation the applied transformation
+ * @param floor the floor to transform
+ */
+void transformFloor(
+    GameState& state,
+    const Transformation& transformation,
+    const unsigned short& floor
+) noexcept
+{
+    using namespace dimensions;
+
+    const unsigned short firstIndex = floor * CELLS_PER_FLOOR;
+
+    const auto& permutation = getFloorPermutation(transformation);
+
+    std::array<char, CELLS_PER_FLOOR> copy;
+
+    std::copy(
+        state.cells.cbegin() + firstIndex,
+        state.cells.cbegin() + firstIndex + CELLS_PER_FLOOR,
+        copy.begin()
+    );
+
+    for (unsigned short index {0}; index < CELLS_PER_FLOOR; index += 1)
+    {
+        state.cells[firstIndex + permutation[index]] = copy[index];
+    }
+
+    if (state.playerIndex / CELLS_PER_FLOOR == floor)
+    {
+        state.playerIndex =
+            firstIndex + permutation[state.playerIndex - firstIndex];
+    }
+}
+
+/**
+ * @brief applies the given transformation on every floor of the level
+ *
+ * @param state the game state to update
+ * @param transformation the applied transformation
+ */
+void transformAllFloors(
+    GameState& state,
+    const Transformation& transformation
+) noexcept
+{
+    for (unsigned short floor {0}; floor < FLOORS_PER_LEVEL; floor += 1)
+    {
+        transformFloor(
+            state,
+            transformation,
+            floor
+        );
+    }
+}
+
+/**
+ * @brief returns true if the cell is removed when the player leaves it
+ *
+ * @param type the type of the left cell
+ *
+ * @return const bool
+ */
+const bool isEmptiedWhenLeft(const char& type) noexcept
+{
+    return
+        type != cells::EMPTY_CELL and
+        type != cells::DEPARTURE_CELL and
+        type != cells::STAIRS_UP_CELL and
+        type != cells::STAIRS_DOWN_CELL and
+        type != cells::ARRIVAL_CELL;
+}
+
+/**
+ * @brief applies the effect of the cell the player just reached
+ *
+ * @param state the game state to update
+ *
+ * @return Event
+ */
+Event executePlayerCellAction(GameState& state) noexcept
+{
+    using namespace dimensions;
+
+    switch(state.cells[state.playerIndex])
+    {
+    case cells::STAR_CELL:
+    {
+        state.foundStars += 1;
+
+        return Event::FoundStar;
+    }
+    case cells::MORE_LIFE_CELL:
+    {
+        state.lifes += 1;
+
+        return Event::FoundLife;
+    }
+    case cells::LESS_LIFE_CELL:
+    {
+        if (state.lifes == 0)
+        {
+            state.status = Status::Lost;
+        }
+        else
+        {
+            state.lifes -= 1;
+        }
+
+        return Event::LostLife;
+    }
+    case cells::MORE_TIME_CELL:
+    {
+        state.watchingTime += WATCHING_TIME_UPDATE_STEP;
+
+        return Event::MoreTime;
+    }
+    case cells::LESS_TIME_CELL:
+    {
+        if (state.watchingTime != MINIMUM_WATCHING_TIME)
+        {
+            state.watchingTime -= WATCHING_TIME_UPDATE_STEP;
+        }
+
+        return Event::LessTime;
+    }
+    case cells::ARRIVAL_CELL:
+    {
+        if (state.foundStars != state.starsAmount)
+        {
+            return Event::None;
+        }
+
+        state.status = Status::Won;
+
+        return Event::Win;
+    }
+    case cells::STAIRS_UP_CELL:
+    case cells::ELEVATOR_UP_CELL:
+    {
+        if (state.floor + 1 == FLOORS_PER_LEVEL)
+        {
+            return Event::None;
+        }
+
+        state.playerIndex += CELLS_PER_FLOOR;
+        state.floor += 1;
+
+        return Event::FloorUp;
+    }
+    case cells::STAIRS_DOWN_CELL:
+    case cells::ELEVATOR_DOWN_CELL:
+    {
+        if (state.floor == 0)
+        {
+            return Event::None;
+        }
+
+        state.playerIndex -= CELLS_PER_FLOOR;
+        state.floor -= 1;
+
+        return Event::FloorDown;
+    }
+    case cells::HORIZONTAL_MIRROR_CELL:
+    {
+        transformAllFloors(
+            state,
+            Transformation::HorizontalMirror
+        );
+
+        return Event::HorizontalMirror;
+    }
+    case cells::VERTICAL_MIRROR_CELL:
+    {
+        transformFloor(
+            state,
+            Transformation::VerticalMirror,
+            state.floor
+        );
+
+        return Event::VerticalMirror;
+    }
+    case cells::DIAGONAL_CELL:
+    {
+        transformAllFloors(
+            state,
+            Transformation::Diagonal
+        );
+
+        return Event::Diagonal;
+    }
+    case cells::LEFT_ROTATION_CELL:
+    {
+        transformAllFloors(
+            state,
+            Transformation::LeftRotation
+        );
+
+        return Event::LeftRotation;
+    }
+    case cells::RIGHT_ROTATION_CELL:
+    {
+        transformAllFloors(
+            state,
+            Transformation::RightRotation
+        );
+
+        return Event::RightRotation;
+    }
+    }
+
+    return Event::None;
+}
+
+/**
+ * @brief moves the player if the movement is allowed
+ *
+ * @param state the game state to update
+ * @param action the movement action
+ *
+ * @return StepResult
+ */
+StepResult movePlayer(
+    GameState& state,
+    const Action& action
+) noexcept
+{
+    using namespace dimensions;
+
+    StepResult result;
+
+    const auto& playerIndex = state.playerIndex;
+    const unsigned short floorFirstIndex = state.floor * CELLS_PER_FLOOR;
+    const unsigned short column = playerIndex % CELLS_PER_LINE;
+
+    bool allowed {true};
+    unsigned short expectedIndex {playerIndex};
+
+    switch(action)
+    {
+    case Action::Up:
+    {
+        allowed = playerIndex >= floorFirstIndex + CELLS_PER_LINE;
+        expectedIndex -= CELLS_PER_LINE;
+
+        break;
+    }
+    case Action::Down:
+    {
+        allowed = playerIndex + CELLS_PER_LINE <
+            floorFirstIndex + CELLS_PER_FLOOR;
+        expectedIndex += CELLS_PER_LINE;
+
+        break;
+    }
+    case Action::Left:
+    {
+        allowed = column != 0;
+        expectedIndex -= 1;
+
+        break;
+    }
+    default:
+    {
+        allowed = column != LAST_LINE_CELL_INDEX;
+        expectedIndex += 1;
+
+        break;
+    }
+    }
+
+    if (not allowed)
+    {
+        result.event = Event::BorderCollision;
+
+        return result;
+    }
+
+    result.cellIndex = expectedIndex;
+
+    if (state.cells[expectedIndex] == cells::WALL_CELL)
+    {
+        result.event = Event::WallCollision;
+
+        return result;
+    }
+
+    auto& leftCell = state.cells[playerIndex];
+
+    if (isEmptiedWhenLeft(leftCell))
+    {
+        leftCell = cells::EMPTY_CELL;
+        result.leftCellEmptied = true;
+    }
+
+    state.playerIndex = expectedIndex;
+    result.moved = true;
+
+    result.event = executePlayerCellAction(state);
+
+    return result;
+}
+
+/**
+ * @brief counts one second of playing time
+ *
+ * @param state the game state to update
+ *
+ * @return StepResult
+ */
+StepResult elapseOneSecond(GameState& state) noexcept
+{
+    StepResult result;
+
+    state.playingTime += 1;
+
+    if (state.remainingTime != 0)
+    {
+        state.remainingTime -= 1;
+    }
+
+    if (
+        state.remainingTime == 0 and
+        state.timeLimited
+    )
+    {
+        state.status = Status::Lost;
+        result.event = Event::TimeOver;
+    }
+
+    return result;
+}
+
+/**
+ *
+ */
+GameState createGameState(
+    const levels::LevelData& data,
+    const unsigned short& lifes,
+    const unsigned short& watchingTime,
+    const bool& timeLimited
+) noexcept
+{
+    constexpr unsigned short SECONDS_PER_MINUTE {60};
+
+    GameState state;
+
+    state.cells = data.cells;
+    state.playerIndex = data.departureIndex;
+    state.floor = data.departureIndex / dimensions::CELLS_PER_FLOOR;
+    state.starsAmount = data.starsAmount;
+    state.lifes = lifes;
+    state.watchingTime = watchingTime;
+    state.remainingTime = data.minutes * SECONDS_PER_MINUTE + data.seconds;
+    state.timeLimited = timeLimited;
+
+    return state;
+}
+
+/**
+ *
+ */
+StepResult step(
+    GameState& state,
+    const Action& action
+) noexcept
+{
+    if (state.status != Status::Playing)
+    {
+        return StepResult();
+    }
+
+    if (action == Action::Second)
+    {
+        return elapseOneSecond(state);
+    }
+
+    return movePlayer(
+        state,
+        action
+    );
+}
+
+}
+}
@@ -0,0 +1,356 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file level_files.cpp
+ * @package levels
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "level_files.hpp"
+
+#include "cells.hpp"
+
+#include <fstream>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace memoris
+{
+namespace levels
+{
+
+constexpr std::uint16_t BINARY_LEVEL_VERSION {1};
+
+constexpr char BINARY_LEVEL_SIGNATURE[] {'M', 'L', 'V', 'B'};
+
+constexpr unsigned short FLOORS_PER_LEVEL {
+    dimensions::CELLS_PER_LEVEL / dimensions::CELLS_PER_FLOOR
+};
+
+/**
+ * @brief header of the binary level file, directly followed by one byte
+ * per cell; the values are written with the endianness of the machine
+ * that converted the level (the binary files are generated at build time)
+ */
+struct BinaryLevelHeader
+{
+    char signature[sizeof(BINARY_LEVEL_SIGNATURE)];
+    std::uint16_t version;
+    std::uint16_t minutes;
+    std::uint16_t seconds;
+    std::uint16_t starsAmount;
+    std::uint16_t departureIndex;
+    std::uint16_t lastPlayableFloor;
+};
+
+constexpr std::size_t BINARY_LEVEL_FILE_SIZE {
+    sizeof(BinaryLevelHeader) + dimensions::CELLS_PER_LEVEL
+};
+
+/**
+ *
+ */
+LevelData loadLevelFile(const std::string& path)
+{
+    const std::string textFilePath = path + TEXT_LEVEL_EXTENSION;
+    const std::string binaryFilePath = path + BINARY_LEVEL_EXTENSION;
+
+    struct stat textFileStatus, binaryFileStatus;
+
+    const bool textFileExists = stat(
+        textFilePath.c_str(),
+        &textFileStatus
+    ) == 0;
+
+    const bool binaryFileExists = stat(
+        binaryFilePath.c_str(),
+        &binaryFileStatus
+    ) == 0;
+
+    /* the text file is the one modified by hand or by the levels editor;
+       an older binary file is outdated and must not be used; the times are
+       compared with their nanoseconds, a text file saved during the same
+       second as the binary one is still detected, and a binary file that
+       is not strictly more recent is not trusted */
+    const auto& binaryTime = binaryFileStatus.st_mtim;
+    const auto& textTime = textFileStatus.st_mtim;
+
+    if (
+        binaryFileExists and
+        (
+            not textFileExists or
+            binaryTime.tv_sec > textTime.tv_sec or
+            (
+                binaryTime.tv_sec == textTime.tv_sec and
+                binaryTime.tv_nsec > textTime.tv_nsec
+            )
+        )
+    )
+    {
+        return loadBinaryLevelFile(binaryFilePath);
+    }
+
+    return loadTextLevelFile(textFilePath);
+}
+
+/**
+ *
+ */
+LevelData loadTextLevelFile(const std::string& filePath)
+{
+    std::ifstream file(filePath);
+
+    if (!file.is_open())
+    {
+        /* TODO: #561 - check PlayingSerieManager.cpp for details */
+        throw std::invalid_argument("Cannot open the given level file");
+    }
+
+    LevelData data;
+
+    /* FIXME: if the minutes/seconds are not specified or partially specified,
+       the behavior is unmanaged */
+    std::string min, sec;
+    getline(file, min, '\n');
+    getline(file, sec, '\n');
+
+    try
+    {
+        data.minutes = static_cast<unsigned short>(std::stoi(min));
+        data.seconds = static_cast<unsigned short>(std::stoi(sec));
+    }
+    catch(std::out_of_range&)
+    {
+        throw std::invalid_argument("Invalid level file time");
+    }
+
+    for (auto& cell : data.cells)
+    {
+        const auto character = file.get();
+
+        /* missing cells at the end of the file are empty cells */
+        cell = file.eof() ? cells::EMPTY_CELL : static_cast<char>(character);
+    }
+
+    updateLevelDataCounters(data);
+
+    return data;
+}
+
+/**
+ *
+ */
+LevelData loadBinaryLevelFile(const std::string& filePath)
+{
+    const int descriptor = open(
+        filePath.c_str(),
+        O_RDONLY
+    );
+
+    if (descriptor == -1)
+    {
+        throw std::invalid_argument("Cannot open the given level file");
+    }
+
+    struct stat status;
+
+    if (
+        fstat(descriptor, &status) == -1 or
+        static_cast<std::size_t>(status.st_size) != BINARY_LEVEL_FILE_SIZE
+    )
+    {
+        close(descriptor);
+
+        throw std::invalid_argument("Unexpected binary level file size");
+    }
+
+    void* mapping = mmap(
+        nullptr,
+        BINARY_LEVEL_FILE_SIZE,
+        PROT_READ,
+        MAP_PRIVATE,
+        descriptor,
+        0
+    );
+
+    /* the mapping stays valid after the descriptor is closed */
+    close(descriptor);
+
+    if (mapping == MAP_FAILED)
+    {
+        throw std::invalid_argument("Cannot map the given level file");
+    }
+
+    const auto bytes = static_cast<const char*>(mapping);
+
+    BinaryLevelHeader header;
+    std::memcpy(
+        &header,
+        bytes,
+        sizeof(BinaryLevelHeader)
+    );
+
+    if (
+        std::memcmp(
+            header.signature,
+            BINARY_LEVEL_SIGNATURE,
+            sizeof(BINARY_LEVEL_SIGNATURE)
+        ) != 0 or
+        header.version != BINARY_LEVEL_VERSION
+    )
+    {
+        munmap(
+            mapping,
+            BINARY_LEVEL_FILE_SIZE
+        );
+
+        throw std::invalid_argument("Unexpected binary level file version");
+    }
+
+    /* the indices of an outdated or corrupted file would be used out of
+       the level cells arrays */
+    if (
+        header.departureIndex >= dimensions::CELLS_PER_LEVEL or
+        header.lastPlayableFloor >= FLOORS_PER_LEVEL
+    )
+    {
+        munmap(
+            mapping,
+            BINARY_LEVEL_FILE_SIZE
+        );
+
+        throw std::invalid_argument("Invalid binary level file header");
+    }
+
+    LevelData data;
+    data.minutes = header.minutes;
+    data.seconds = header.seconds;
+    data.starsAmount = header.starsAmount;
+    data.departureIndex = header.departureIndex;
+    data.lastPlayableFloor = header.lastPlayableFloor;
+
+    std::memcpy(
+        data.cells.data(),
+        bytes + sizeof(BinaryLevelHeader),
+        dimensions::CELLS_PER_LEVEL
+    );
+
+    munmap(
+        mapping,
+        BINARY_LEVEL_FILE_SIZE
+    );
+
+    return data;
+}
+
+/**
+ *
+ */
+void writeBinaryLevelFile(
+    const std::string& filePath,
+    const LevelData& data
+)
+{
+    BinaryLevelHeader header;
+
+    std::memcpy(
+        header.signature,
+        BINARY_LEVEL_SIGNATURE,
+        sizeof(BINARY_LEVEL_SIGNATURE)
+    );
+
+    header.version = BINARY_LEVEL_VERSION;
+    header.minutes = data.minutes;
+    header.seconds = data.seconds;
+    header.starsAmount = data.starsAmount;
+    header.departureIndex = data.departureIndex;
+    header.lastPlayableFloor = data.lastPlayableFloor;
+
+    std::ofstream file(
+        filePath,
+        std::ios::out | std::ios::binary | std::ios::trunc
+    );
+
+    file.write(
+        reinterpret_cast<const char*>(&header),
+        sizeof(BinaryLevelHeader)
+    );
+
+    file.write(
+        data.cells.data(),
+        dimensions::CELLS_PER_LEVEL
+    );
+
+    if (!file.good())
+    {
+        throw std::invalid_argument("Cannot write the given level file");
+    }
+}
+
+/**
+ *
+ */
+void updateLevelDataCounters(LevelData& data) noexcept
+{
+    data.starsAmount = 0;
+    data.departureIndex = 0;
+
+    unsigned short lastPlayableCell {0};
+
+    for (
+        unsigned short index {0};
+        index < dimensions::CELLS_PER_LEVEL;
+        index += 1
+    )
+    {
+        const auto& type = data.cells[index];
+
+        switch(type)
+        {
+        case cells::DEPARTURE_CELL:
+        {
+            data.departureIndex = index;
+
+            break;
+        }
+        case cells::STAR_CELL:
+        {
+            data.starsAmount += 1;
+
+            break;
+        }
+        }
+
+        if (type != cells::WALL_CELL)
+        {
+            lastPlayableCell = index;
+        }
+    }
+
+    data.lastPlayableFloor = lastPlayableCell / dimensions::CELLS_PER_FLOOR;
+}
+
+}
+}
@@ -23,18 +23,24 @@
 
 #include "Controller.hpp"
 #include "Context.hpp"
-#include "controllers.hpp"
+#include "ControllerPool.hpp"
 #include "controllers_ids.hpp"
 #include "SoundsManager.hpp"
+#include "ProfiledWindow.hpp"
+#include "FrameProfiler.hpp"
+#include "PerformanceOverlay.hpp"
 
-#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Window/Keyboard.hpp>
+
+#include <string>
+#include <stdexcept>
 
 using namespace memoris;
 
 /**
  *
  */
-int main()
+int main(int argc, char* argv[])
 {
     using namespace controllers;
     using namespace utils;
@@ -44,36 +50,162 @@ int main()
 
     utils::Context context;
 
+    /* memoris --replay <file> directly plays the given replay file,
+       --profile displays the performance overlay (also toggled with F3),
+       --trace <file> writes the last frames timings as a Chrome trace
+       when the game is closed */
+    bool overlayDisplayed {false};
+    std::string traceFilePath;
+
+    for (int index {1}; index < argc; index += 1)
+    {
+        const std::string argument = argv[index];
+
+        if (argument == "--profile")
+        {
+            overlayDisplayed = true;
+        }
+        else if (index + 1 < argc and argument == "--replay")
+        {
+            index += 1;
+
+            context.setReplayFilePath(argv[index]);
+            nextControllerId = ControllerId::Game;
+        }
+        else if (index + 1 < argc and argument == "--trace")
+        {
+            index += 1;
+
+            traceFilePath = argv[index];
+        }
+    }
+
+    const auto& profiler = context.getFrameProfiler();
+    widgets::PerformanceOverlay overlay(context);
+    bool overlayKeyPressed {false};
+
     Context::MusicId currentMusicId {Context::MusicId::MenuMusic},
         nextMusicId {Context::MusicId::MenuMusic};
-    context.loadMusicFile(currentMusicId);
+    context.playMusic(currentMusicId);
+
+    /* the next music is selected once, when the transition starts */
+    bool nextMusicSelected {false};
 
     auto& window = context.getSfmlWindow();
 
+    ControllerPool controllers(context);
+
+    profiler.startFrame();
+
     do
     {
-        const auto controller =
-            getControllerById(
-                context,
-                nextControllerId,
-                currentControllerId
-            );
+        /* the controller creation (level loading...) is reported
+           into the first frame of the controller */
+        auto startTime = profiler.getTime();
+
+        const auto& controller = controllers.getController(
+            nextControllerId,
+            currentControllerId
+        );
+
+        profiler.addSectionTime(
+            utils::FrameProfiler::Section::Loading,
+            startTime
+        );
 
         currentControllerId = nextControllerId;
 
+        /* the first frame of a controller is always drawn */
+        window.invalidate();
+
         do
         {
+            /* the controllers that do not track their changes are drawn
+               at every frame, the other ones only when their scene has
+               changed; the profiler overlay is always updated */
+            if (not controller.isRedrawTracked() or overlayDisplayed)
+            {
+                window.invalidate();
+            }
+
             /* NOTE: this instruction generates memory leaks; as it comes from
                the external dynamic library and because it is an insignificant
                amount of memory (63 bytes), I just ignore it; the generated
                error is (Valgrind) :
                by 0x527434E: sf::RenderTarget::clear(sf::Color const&)
                (in /usr/lib/x86_64-linux-gnu/libsfml-graphics.so.2.1) */
-            window.clear();
+            if (window.startFrame())
+            {
+                window.clear();
+            }
 
-            nextControllerId = controller->render();
+            startTime = profiler.getTime();
+
+            nextControllerId = controller.render();
+
+            profiler.addSectionTime(
+                utils::FrameProfiler::Section::Render,
+                startTime
+            );
 
-            window.display();
+            /* the next menu is built during the transition to it, its
+               creation is hidden by the transition animation */
+            const auto& expectedControllerId =
+                controller.getExpectedControllerId();
+
+            if (expectedControllerId != ControllerId::NoController)
+            {
+                startTime = profiler.getTime();
+
+                controllers.prepareController(expectedControllerId);
+
+                profiler.addSectionTime(
+                    utils::FrameProfiler::Section::Loading,
+                    startTime
+                );
+
+                if (not nextMusicSelected)
+                {
+                    nextMusicId = context.getMusicId(expectedControllerId);
+                    nextMusicSelected = true;
+
+                    if (nextMusicId != currentMusicId)
+                    {
+                        context.prefetchMusic(nextMusicId);
+                    }
+                }
+            }
+
+            /* the key state is read directly, the events are polled
+               by the controllers */
+            const bool overlayKeyDown =
+                sf::Keyboard::isKeyPressed(sf::Keyboard::F3);
+
+            if (overlayKeyDown and not overlayKeyPressed)
+            {
+                overlayDisplayed = not overlayDisplayed;
+
+                window.invalidate();
+            }
+
+            overlayKeyPressed = overlayKeyDown;
+
+            if (overlayDisplayed)
+            {
+                overlay.display();
+            }
+
+            startTime = profiler.getTime();
+
+            window.endFrame();
+
+            profiler.addSectionTime(
+                utils::FrameProfiler::Section::Display,
+                startTime
+            );
+
+            profiler.endFrame();
+            profiler.startFrame();
         }
         while (nextControllerId == ControllerId::NoController);
 
@@ -82,14 +214,19 @@ int main()
             continue;
         }
 
-        nextMusicId = context.getMusicId(nextControllerId);
+        if (not nextMusicSelected)
+        {
+            nextMusicId = context.getMusicId(nextControllerId);
+        }
+
+        nextMusicSelected = false;
 
         if (
             currentControllerId != nextControllerId and
             nextMusicId != currentMusicId
         )
         {
-            context.loadMusicFile(nextMusicId);
+            context.playMusic(nextMusicId);
             currentMusicId = nextMusicId;
         }
 
@@ -103,5 +240,17 @@ int main()
 
     window.close();
 
+    if (not traceFilePath.empty())
+    {
+        try
+        {
+            profiler.writeChromeTrace(traceFilePath);
+        }
+        catch(std::invalid_argument&)
+        {
+            /* the game is already closed, nothing can be displayed */
+        }
+    }
+
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,334 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file replays.cpp
+ * @package replays
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "replays.hpp"
+
+#include <fstream>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+
+namespace memoris
+{
+namespace replays
+{
+
+constexpr std::uint16_t REPLAY_VERSION {1};
+
+constexpr char REPLAY_SIGNATURE[] {'M', 'R', 'P', 'L'};
+
+constexpr unsigned short ACTION_BITS {3};
+constexpr unsigned int ACTION_MASK {(1u << ACTION_BITS) - 1};
+
+constexpr unsigned char VARIABLE_INTEGER_BITS {7};
+constexpr unsigned char VARIABLE_INTEGER_MASK {0x7F};
+constexpr unsigned char VARIABLE_INTEGER_CONTINUATION {0x80};
+
+/* the steps values are 64 bits integers */
+constexpr unsigned short VARIABLE_INTEGER_MAXIMUM_SHIFT {64};
+
+/**
+ * @brief writes one fixed size value, with the endianness of the machine
+ */
+template<typename T>
+void writeValue(
+    std::ofstream& file,
+    const T& value
+)
+{
+    file.write(
+        reinterpret_cast<const char*>(&value),
+        sizeof(T)
+    );
+}
+
+/**
+ * @brief reads one fixed size value, throws if the file is truncated
+ */
+template<typename T>
+T readValue(std::ifstream& file)
+{
+    T value;
+
+    file.read(
+        reinterpret_cast<char*>(&value),
+        sizeof(T)
+    );
+
+    if (!file.good())
+    {
+        throw std::invalid_argument("Truncated replay file");
+    }
+
+    return value;
+}
+
+/**
+ *
+ */
+game::GameState createReplayGameState(const Replay& replay) noexcept
+{
+    return game::createGameState(
+        replay.level,
+        replay.lifes,
+        replay.watchingTime,
+        replay.displayedWatchingTime != 0
+    );
+}
+
+/**
+ *
+ */
+game::GameState playReplay(const Replay& replay) noexcept
+{
+    auto state = createReplayGameState(replay);
+
+    for (const auto& step : replay.steps)
+    {
+        game::step(
+            state,
+            step.action
+        );
+    }
+
+    return state;
+}
+
+/**
+ *
+ */
+void writeReplayFile(
+    const std::string& filePath,
+    const Replay& replay
+)
+{
+    std::ofstream file(
+        filePath,
+        std::ios::out | std::ios::binary | std::ios::trunc
+    );
+
+    file.write(
+        REPLAY_SIGNATURE,
+        sizeof(REPLAY_SIGNATURE)
+    );
+
+    const auto& level = replay.level;
+
+    writeValue<std::uint16_t>(file, REPLAY_VERSION);
+    writeValue<std::uint16_t>(file, replay.lifes);
+    writeValue<std::uint16_t>(file, replay.watchingTime);
+    writeValue<std::uint16_t>(file, replay.displayedWatchingTime);
+    writeValue<std::uint8_t>(file, static_cast<std::uint8_t>(replay.status));
+    writeValue<std::uint16_t>(file, level.minutes);
+    writeValue<std::uint16_t>(file, level.seconds);
+    writeValue<std::uint16_t>(file, level.starsAmount);
+    writeValue<std::uint16_t>(file, level.departureIndex);
+    writeValue<std::uint16_t>(file, level.lastPlayableFloor);
+
+    file.write(
+        level.cells.data(),
+        dimensions::CELLS_PER_LEVEL
+    );
+
+    writeValue<std::uint32_t>(
+        file,
+        static_cast<std::uint32_t>(replay.steps.size())
+    );
+
+    unsigned int previousTime {0};
+
+    for (const auto& step : replay.steps)
+    {
+        /* the times only increase, the difference is always positive */
+        std::uint64_t value = step.time - previousTime;
+        value = (value << ACTION_BITS) | static_cast<unsigned int>(step.action);
+
+        previousTime = step.time;
+
+        do
+        {
+            unsigned char byte = value & VARIABLE_INTEGER_MASK;
+            value >>= VARIABLE_INTEGER_BITS;
+
+            if (value != 0)
+            {
+                byte |= VARIABLE_INTEGER_CONTINUATION;
+            }
+
+            file.put(static_cast<char>(byte));
+        }
+        while (value != 0);
+    }
+
+    if (!file.good())
+    {
+        throw std::invalid_argument("Cannot write the given replay file");
+    }
+}
+
+/**
+ *
+ */
+Replay loadReplayFile(const std::string& filePath)
+{
+    std::ifstream file(
+        filePath,
+        std::ios::in | std::ios::binary
+    );
+
+    if (!file.is_open())
+    {
+        throw std::invalid_argument("Cannot open the given replay file");
+    }
+
+    char signature[sizeof(REPLAY_SIGNATURE)];
+    file.read(
+        signature,
+        sizeof(REPLAY_SIGNATURE)
+    );
+
+    if (
+        !file.good() or
+        std::memcmp(
+            signature,
+            REPLAY_SIGNATURE,
+            sizeof(REPLAY_SIGNATURE)
+        ) != 0 or
+        readValue<std::uint16_t>(file) != REPLAY_VERSION
+    )
+    {
+        throw std::invalid_argument("Unexpected replay file version");
+    }
+
+    Replay replay;
+    auto& level = replay.level;
+
+    replay.lifes = readValue<std::uint16_t>(file);
+    replay.watchingTime = readValue<std::uint16_t>(file);
+    replay.displayedWatchingTime = readValue<std::uint16_t>(file);
+
+    const auto status = readValue<std::uint8_t>(file);
+
+    if (status > static_cast<std::uint8_t>(game::Status::Lost))
+    {
+        throw std::invalid_argument("Unexpected replay status");
+    }
+
+    replay.status = static_cast<game::Status>(status);
+
+    level.minutes = readValue<std::uint16_t>(file);
+    level.seconds = readValue<std::uint16_t>(file);
+    level.starsAmount = readValue<std::uint16_t>(file);
+    level.departureIndex = readValue<std::uint16_t>(file);
+    level.lastPlayableFloor = readValue<std::uint16_t>(file);
+
+    if (
+        level.departureIndex >= dimensions::CELLS_PER_LEVEL or
+        level.lastPlayableFloor >= game::FLOORS_PER_LEVEL
+    )
+    {
+        throw std::invalid_argument("Unexpected replay level");
+    }
+
+    file.read(
+        level.cells.data(),
+        dimensions::CELLS_PER_LEVEL
+    );
+
+    if (file.gcount() != dimensions::CELLS_PER_LEVEL)
+    {
+        throw std::invalid_argument("Truncated replay file");
+    }
+
+    const auto stepsAmount = readValue<std::uint32_t>(file);
+
+    /* every step is written with one byte at least, a bigger amount
+       comes from a corrupted file and must not be allocated */
+    const auto stepsPosition = file.tellg();
+    file.seekg(0, std::ios::end);
+    const auto remainingBytes = file.tellg() - stepsPosition;
+    file.seekg(stepsPosition);
+
+    if (stepsAmount > remainingBytes)
+    {
+        throw std::invalid_argument("Truncated replay file");
+    }
+
+    replay.steps.reserve(stepsAmount);
+
+    unsigned int time {0};
+
+    for (
+        std::uint32_t index {0};
+        index < stepsAmount;
+        index += 1
+    )
+    {
+        std::uint64_t value {0};
+        unsigned short shift {0};
+        int byte;
+
+        do
+        {
+            if (shift >= VARIABLE_INTEGER_MAXIMUM_SHIFT)
+            {
+                throw std::invalid_argument("Unexpected replay step");
+            }
+
+            byte = file.get();
+
+            if (byte == std::char_traits<char>::eof())
+            {
+                throw std::invalid_argument("Truncated replay file");
+            }
+
+            value |= static_cast<std::uint64_t>(
+                byte & VARIABLE_INTEGER_MASK
+            ) << shift;
+
+            shift += VARIABLE_INTEGER_BITS;
+        }
+        while (byte & VARIABLE_INTEGER_CONTINUATION);
+
+        if ((value & ACTION_MASK) > static_cast<unsigned int>(
+            game::Action::Second
+        ))
+        {
+            throw std::invalid_argument("Unexpected replay action");
+        }
+
+        time += static_cast<unsigned int>(value >> ACTION_BITS);
+
+        ReplayStep step;
+        step.time = time;
+        step.action = static_cast<game::Action>(value & ACTION_MASK);
+
+        replay.steps.push_back(step);
+    }
+
+    return replay;
+}
+
+}
+}
@@ -0,0 +1,311 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * @file resource_pack.cpp
+ * @package resources
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "resource_pack.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace memoris
+{
+namespace resources
+{
+
+constexpr std::uint16_t RESOURCE_PACK_VERSION {1};
+
+constexpr char RESOURCE_PACK_SIGNATURE[] {'M', 'R', 'E', 'S'};
+
+constexpr std::size_t RESOURCE_NAME_MAXIMUM_LENGTH {63};
+
+/**
+ * @brief header of the pack, directly followed by one entry per resource,
+ * then by the resources bytes; the values are written with the endianness
+ * of the machine that built the pack (the pack is generated at build time)
+ */
+struct ResourcePackHeader
+{
+    char signature[sizeof(RESOURCE_PACK_SIGNATURE)];
+    std::uint16_t version;
+    std::uint16_t resourcesAmount;
+};
+
+/**
+ * @brief position of one resource into the pack, from the beginning of
+ * the file; the name is terminated by a null character
+ */
+struct ResourcePackEntry
+{
+    char name[RESOURCE_NAME_MAXIMUM_LENGTH + 1];
+    std::uint32_t offset;
+    std::uint32_t size;
+};
+
+/**
+ *
+ */
+ResourcePack mapResourcePack(const std::string& filePath)
+{
+    const int descriptor = open(
+        filePath.c_str(),
+        O_RDONLY
+    );
+
+    if (descriptor == -1)
+    {
+        throw std::invalid_argument("Cannot open the resources pack");
+    }
+
+    struct stat status;
+
+    if (
+        fstat(descriptor, &status) == -1 or
+        static_cast<std::size_t>(status.st_size) < sizeof(ResourcePackHeader)
+    )
+    {
+        close(descriptor);
+
+        throw std::invalid_argument("Unexpected resources pack size");
+    }
+
+    const auto fileSize = static_cast<std::size_t>(status.st_size);
+
+    void* mapping = mmap(
+        nullptr,
+        fileSize,
+        PROT_READ,
+        MAP_PRIVATE,
+        descriptor,
+        0
+    );
+
+    /* the mapping stays valid after the descriptor is closed */
+    close(descriptor);
+
+    if (mapping == MAP_FAILED)
+    {
+        throw std::invalid_argument("Cannot map the resources pack");
+    }
+
+    ResourcePack pack;
+    pack.mapping = std::shared_ptr<const char>(
+        static_cast<const char*>(mapping),
+        [fileSize](const char* bytes)
+        {
+            munmap(
+                const_cast<char*>(bytes),
+                fileSize
+            );
+        }
+    );
+
+    const auto bytes = pack.mapping.get();
+
+    ResourcePackHeader header;
+    std::memcpy(
+        &header,
+        bytes,
+        sizeof(ResourcePackHeader)
+    );
+
+    const std::size_t indexEnd =
+        sizeof(ResourcePackHeader) +
+        header.resourcesAmount * sizeof(ResourcePackEntry);
+
+    if (
+        std::memcmp(
+            header.signature,
+            RESOURCE_PACK_SIGNATURE,
+            sizeof(RESOURCE_PACK_SIGNATURE)
+        ) != 0 or
+        header.version != RESOURCE_PACK_VERSION or
+        indexEnd > fileSize
+    )
+    {
+        throw std::invalid_argument("Unexpected resources pack version");
+    }
+
+    for (
+        std::size_t index {0};
+        index < header.resourcesAmount;
+        index += 1
+    )
+    {
+        ResourcePackEntry entry;
+        std::memcpy(
+            &entry,
+            bytes + sizeof(ResourcePackHeader) +
+                index * sizeof(ResourcePackEntry),
+            sizeof(ResourcePackEntry)
+        );
+
+        if (
+            entry.name[RESOURCE_NAME_MAXIMUM_LENGTH] != '\0' or
+            entry.offset > fileSize or
+            entry.size > fileSize - entry.offset
+        )
+        {
+            throw std::invalid_argument("Corrupted resources pack index");
+        }
+
+        ResourceData data;
+        data.bytes = bytes + entry.offset;
+        data.size = entry.size;
+
+        pack.resources[entry.name] = data;
+    }
+
+    return pack;
+}
+
+/**
+ *
+ */
+const ResourceData& getResource(
+    const ResourcePack& pack,
+    const std::string& name
+)
+{
+    const auto resource = pack.resources.find(name);
+
+    if (resource == pack.resources.cend())
+    {
+        throw std::invalid_argument("Missing packed resource : " + name);
+    }
+
+    return resource->second;
+}
+
+/**
+ *
+ */
+void writeResourcePack(
+    const std::string& filePath,
+    const std::string& directory,
+    const std::vector<std::string>& names
+)
+{
+    std::vector<std::vector<char>> contents;
+    contents.reserve(names.size());
+
+    for (const auto& name : names)
+    {
+        if (name.size() > RESOURCE_NAME_MAXIMUM_LENGTH)
+        {
+            throw std::invalid_argument("Too long resource name : " + name);
+        }
+
+        std::ifstream resource(
+            directory + "/" + name,
+            std::ios::in | std::ios::binary
+        );
+
+        if (!resource.is_open())
+        {
+            throw std::invalid_argument("Cannot read the resource " + name);
+        }
+
+        contents.emplace_back(
+            std::istreambuf_iterator<char>(resource),
+            std::istreambuf_iterator<char>()
+        );
+    }
+
+    ResourcePackHeader header;
+
+    std::memcpy(
+        header.signature,
+        RESOURCE_PACK_SIGNATURE,
+        sizeof(RESOURCE_PACK_SIGNATURE)
+    );
+
+    header.version = RESOURCE_PACK_VERSION;
+    header.resourcesAmount = static_cast<std::uint16_t>(names.size());
+
+    std::ofstream file(
+        filePath,
+        std::ios::out | std::ios::binary | std::ios::trunc
+    );
+
+    file.write(
+        reinterpret_cast<const char*>(&header),
+        sizeof(ResourcePackHeader)
+    );
+
+    std::size_t offset =
+        sizeof(ResourcePackHeader) +
+        names.size() * sizeof(ResourcePackEntry);
+
+    for (
+        std::size_t index {0};
+        index < names.size();
+        index += 1
+    )
+    {
+        ResourcePackEntry entry;
+        std::memset(
+            &entry,
+            0,
+            sizeof(ResourcePackEntry)
+        );
+
+        std::memcpy(
+            entry.name,
+            names[index].c_str(),
+            names[index].size()
+        );
+
+        entry.offset = static_cast<std::uint32_t>(offset);
+        entry.size = static_cast<std::uint32_t>(contents[index].size());
+
+        file.write(
+            reinterpret_cast<const char*>(&entry),
+            sizeof(ResourcePackEntry)
+        );
+
+        offset += contents[index].size();
+    }
+
+    for (const auto& content : contents)
+    {
+        file.write(
+            content.data(),
+            content.size()
+        );
+    }
+
+    if (!file.good())
+    {
+        throw std::invalid_argument("Cannot write the resources pack");
+    }
+}
+
+}
+}
@@ -0,0 +1,669 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file bench.cpp
+ * @brief measures the level loading, rendering and animations hot paths
+ * and writes the results as JSON (memoris-bench --output bench.json
+ * data/levels/officials/a); the level path is given without extension,
+ * like for the game levels loader; the frames are drawn into a hidden
+ * window, every drawn sample waits for the graphic card
+ * @package tools
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "Context.hpp"
+#include "Level.hpp"
+#include "level_files.hpp"
+#include "floor_permutations.hpp"
+#include "dimensions.hpp"
+#include "cells.hpp"
+#include "CellsTexturesManager.hpp"
+#include "MenuGradient.hpp"
+#include "ProfiledWindow.hpp"
+#include "LevelAnimation.hpp"
+#include "HorizontalMirrorAnimation.hpp"
+#include "VerticalMirrorAnimation.hpp"
+#include "DiagonalAnimation.hpp"
+#include "RotateFloorAnimation.hpp"
+#include "window.hpp"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/OpenGL.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+
+namespace
+{
+
+using namespace memoris;
+
+using Clock = std::chrono::steady_clock;
+
+/* the levels are loaded by path without extension, the binary file is
+   used if it is up to date, the text file otherwise */
+constexpr const char* DEFAULT_LEVEL_FILE {"data/levels/officials/a"};
+
+/* every benchmark is measured by samples of a fixed amount of iterations,
+   the first samples are only used to warm up the caches */
+constexpr unsigned int WARM_UP_SAMPLES {3};
+constexpr unsigned int MEASURED_SAMPLES {30};
+
+/* the floor that is permuted and animated */
+constexpr unsigned short PERMUTED_FLOOR {0};
+
+/* an animation that is not finished after this duration is stopped */
+constexpr std::chrono::seconds ANIMATION_TIMEOUT {30};
+
+/* the animations are played at the game frame rate */
+constexpr std::chrono::microseconds ANIMATION_FRAME_DURATION {
+    1000000 / window::FPS_LIMIT
+};
+
+struct BenchmarkResult
+{
+    std::string name;
+
+    unsigned int iterations {0};
+    unsigned int samples {0};
+
+    /* durations of one iteration, in nanoseconds */
+    double mean {0.};
+    double median {0.};
+    double minimum {0.};
+    double maximum {0.};
+};
+
+/**
+ * @brief summarizes the measured durations of one iteration
+ *
+ * @param name the benchmark name
+ * @param iterations the amount of iterations per sample
+ * @param durations the duration of one iteration for every sample,
+ * in nanoseconds; the container is sorted by the function
+ *
+ * @return BenchmarkResult
+ */
+BenchmarkResult summarize(
+    const std::string& name,
+    const unsigned int& iterations,
+    std::vector<double>& durations
+)
+{
+    BenchmarkResult result;
+    result.name = name;
+    result.iterations = iterations;
+    result.samples = static_cast<unsigned int>(durations.size());
+
+    if (durations.empty())
+    {
+        return result;
+    }
+
+    std::sort(
+        durations.begin(),
+        durations.end()
+    );
+
+    double total {0.};
+
+    for (const auto& duration : durations)
+    {
+        total += duration;
+    }
+
+    result.mean = total / static_cast<double>(durations.size());
+    result.median = durations[durations.size() / 2];
+    result.minimum = durations.front();
+    result.maximum = durations.back();
+
+    return result;
+}
+
+/**
+ * @brief runs the given function by samples of the given amount of
+ * iterations; one sample is timed as a whole, so the clock precision
+ * does not limit the measure of the fast functions; when the function
+ * draws, every sample is drawn into a cleared frame and the measure waits
+ * until the graphic card has executed the draw calls, the frame is
+ * displayed after the measure
+ *
+ * @param name the benchmark name
+ * @param iterations the amount of calls per sample
+ * @param function the measured function
+ * @param window the window the function draws into, nullptr if the
+ * function does not draw
+ *
+ * @return BenchmarkResult
+ */
+template<typename Function>
+BenchmarkResult runBenchmark(
+    const std::string& name,
+    const unsigned int& iterations,
+    const Function& function,
+    utils::ProfiledWindow* window = nullptr
+)
+{
+    std::vector<double> durations;
+    durations.reserve(MEASURED_SAMPLES);
+
+    for (
+        unsigned int sample {0};
+        sample < WARM_UP_SAMPLES + MEASURED_SAMPLES;
+        sample += 1
+    )
+    {
+        if (window != nullptr)
+        {
+            window->clear();
+        }
+
+        const auto start = Clock::now();
+
+        for (
+            unsigned int iteration {0};
+            iteration < iterations;
+            iteration += 1
+        )
+        {
+            function();
+        }
+
+        if (window != nullptr)
+        {
+            glFinish();
+        }
+
+        const std::chrono::duration<double, std::nano> elapsed =
+            Clock::now() - start;
+
+        if (window != nullptr)
+        {
+            window->display();
+        }
+
+        if (sample >= WARM_UP_SAMPLES)
+        {
+            durations.push_back(elapsed.count() / iterations);
+        }
+    }
+
+    std::cerr << name << ": " << durations.size() << " samples"
+        << std::endl;
+
+    return summarize(
+        name,
+        iterations,
+        durations
+    );
+}
+
+/**
+ * @brief plays the given animation until it is finished, at the game frame
+ * rate; every frame is one sample, measured until the graphic card has
+ * executed its draw calls; the animations steps are timed, so the
+ * benchmark lasts as long as the animation in the game
+ *
+ * @param name the benchmark name
+ * @param animation the played animation
+ * @param window the window the animation draws into
+ *
+ * @return BenchmarkResult
+ */
+BenchmarkResult runAnimationBenchmark(
+    const std::string& name,
+    animations::LevelAnimation& animation,
+    utils::ProfiledWindow& window
+)
+{
+    std::vector<double> durations;
+
+    const auto timeout = Clock::now() + ANIMATION_TIMEOUT;
+    auto nextFrame = Clock::now();
+
+    while (
+        not animation.isFinished() and
+        Clock::now() < timeout
+    )
+    {
+        /* the frames are paced like in the game, a slow frame is not
+           followed by a burst of frames */
+        std::this_thread::sleep_until(nextFrame);
+        nextFrame = std::max(
+            nextFrame + ANIMATION_FRAME_DURATION,
+            Clock::now()
+        );
+
+        window.clear();
+
+        const auto start = Clock::now();
+
+        animation.renderAnimation();
+
+        glFinish();
+
+        const std::chrono::duration<double, std::nano> elapsed =
+            Clock::now() - start;
+
+        window.display();
+
+        durations.push_back(elapsed.count());
+    }
+
+    std::cerr << name << ": " << durations.size() << " frames"
+        << std::endl;
+
+    constexpr unsigned int ONE_FRAME {1};
+    return summarize(
+        name,
+        ONE_FRAME,
+        durations
+    );
+}
+
+/**
+ * @brief removes the text or binary level extension of the given path,
+ * if any; the levels loader expects a path without extension
+ *
+ * @param path the level file path
+ *
+ * @return std::string
+ */
+std::string removeLevelExtension(const std::string& path)
+{
+    for (
+        const std::string extension : {
+            levels::TEXT_LEVEL_EXTENSION,
+            levels::BINARY_LEVEL_EXTENSION
+        }
+    )
+    {
+        if (
+            path.size() > extension.size() and
+            path.compare(
+                path.size() - extension.size(),
+                extension.size(),
+                extension
+            ) == 0
+        )
+        {
+            return path.substr(
+                0,
+                path.size() - extension.size()
+            );
+        }
+    }
+
+    return path;
+}
+
+/**
+ * @brief writes the results as a JSON document
+ *
+ * @param stream the output stream
+ * @param levelFilePath the benchmarked level file
+ * @param results the benchmarks results
+ */
+void writeResults(
+    std::ostream& stream,
+    const std::string& levelFilePath,
+    const std::vector<BenchmarkResult>& results
+)
+{
+    /* the names and the path never contain characters to escape,
+       except the level path that is given by the user */
+    std::string escapedPath;
+
+    for (const auto& character : levelFilePath)
+    {
+        if (character == '"' or character == '\\')
+        {
+            escapedPath += '\\';
+        }
+
+        escapedPath += character;
+    }
+
+    stream << "{\n"
+        << "  \"level\": \"" << escapedPath << "\",\n"
+        << "  \"unit\": \"ns\",\n"
+        << "  \"benchmarks\": [\n";
+
+    for (
+        std::size_t index {0};
+        index < results.size();
+        index += 1
+    )
+    {
+        const auto& result = results[index];
+
+        stream << "    {\"name\": \"" << result.name << "\", "
+            << "\"iterations\": " << result.iterations << ", "
+            << "\"samples\": " << result.samples << ", "
+            << "\"mean\": " << result.mean << ", "
+            << "\"median\": " << result.median << ", "
+            << "\"min\": " << result.minimum << ", "
+            << "\"max\": " << result.maximum << "}"
+            << (index + 1 == results.size() ? "\n" : ",\n");
+    }
+
+    stream << "  ]\n"
+        << "}\n";
+}
+
+}
+
+/**
+ * @brief measures the hot paths of the game with the given level file,
+ * the results are written on the standard output or in the given file
+ * (memoris-bench [--output <file>] [<level path without extension>])
+ */
+int main(int argc, char* argv[])
+{
+    std::string outputFilePath;
+    std::string levelFilePath {DEFAULT_LEVEL_FILE};
+
+    for (int index {1}; index < argc; index += 1)
+    {
+        const std::string argument = argv[index];
+
+        if (index + 1 < argc and argument == "--output")
+        {
+            index += 1;
+
+            outputFilePath = argv[index];
+        }
+        else
+        {
+            levelFilePath = removeLevelExtension(argument);
+        }
+    }
+
+    levels::LevelData data;
+
+    try
+    {
+        data = levels::loadLevelFile(levelFilePath);
+    }
+    catch(std::invalid_argument& exception)
+    {
+        std::cerr << levelFilePath << ": " << exception.what() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    /* the context loads the resources and creates the window every
+       component of the game draws into; the window is hidden, not
+       fullscreen, and its frames are not limited */
+    utils::Context context {utils::Context::WindowMode::Hidden};
+
+    auto& window = context.getSfmlWindow();
+
+    std::vector<BenchmarkResult> results;
+
+    /* level loading */
+
+    constexpr unsigned int LOADING_ITERATIONS {20};
+    results.push_back(
+        runBenchmark(
+            "level_load_file",
+            LOADING_ITERATIONS,
+            [&levelFilePath, &context]()
+            {
+                entities::Level level(
+                    context,
+                    levels::loadLevelFile(levelFilePath)
+                );
+            }
+        )
+    );
+
+    constexpr unsigned int CONSTRUCTION_ITERATIONS {100};
+    results.push_back(
+        runBenchmark(
+            "level_construction",
+            CONSTRUCTION_ITERATIONS,
+            [&data, &context]()
+            {
+                entities::Level level(
+                    context,
+                    data
+                );
+            }
+        )
+    );
+
+    /* level rendering */
+
+    const auto level = std::make_shared<entities::Level>(
+        context,
+        data
+    );
+
+    constexpr unsigned int DISPLAY_ITERATIONS {200};
+
+    for (
+        unsigned short floor {0};
+        floor <= level->getLastPlayableFloor();
+        floor += 1
+    )
+    {
+        results.push_back(
+            runBenchmark(
+                "level_display_floor_" + std::to_string(floor),
+                DISPLAY_ITERATIONS,
+                [&level, floor]()
+                {
+                    level->display(floor);
+                },
+                &window
+            )
+        );
+    }
+
+    /* floors permutations: the cells moves of the mirror, diagonal and
+       rotation animations (the level is permuted back and forth) */
+
+    constexpr unsigned int PERMUTATION_ITERATIONS {1000};
+
+    const std::vector<std::pair<std::string, game::Transformation>>
+        transformations {
+        {"permute_horizontal_mirror", game::Transformation::HorizontalMirror},
+        {"permute_vertical_mirror", game::Transformation::VerticalMirror},
+        {"permute_diagonal", game::Transformation::Diagonal},
+        {"permute_left_rotation", game::Transformation::LeftRotation},
+        {"permute_right_rotation", game::Transformation::RightRotation}
+    };
+
+    for (const auto& transformation : transformations)
+    {
+        const auto& permutation =
+            game::getFloorPermutation(transformation.second);
+
+        results.push_back(
+            runBenchmark(
+                transformation.first,
+                PERMUTATION_ITERATIONS,
+                [&level, &permutation]()
+                {
+                    level->permuteFloorCells(
+                        PERMUTED_FLOOR,
+                        permutation
+                    );
+                }
+            )
+        );
+    }
+
+    const auto& quartersPermutation = game::getFloorPermutation(
+        game::QuartersSwap::TopLeftWithBottomRight
+    );
+
+    results.push_back(
+        runBenchmark(
+            "permute_quarters_swap",
+            PERMUTATION_ITERATIONS,
+            [&level, &quartersPermutation]()
+            {
+                level->permuteFloorCells(
+                    PERMUTED_FLOOR,
+                    quartersPermutation
+                );
+            }
+        )
+    );
+
+    /* cells textures lookups: one lookup per cell of the level */
+
+    const auto& cellsTextures = context.getCellsTexturesManager();
+
+    constexpr unsigned int LOOKUP_ITERATIONS {100};
+    results.push_back(
+        runBenchmark(
+            "cells_textures_lookups",
+            LOOKUP_ITERATIONS,
+            [&data, &cellsTextures]()
+            {
+                int checksum {0};
+
+                for (const auto& type : data.cells)
+                {
+                    checksum += cellsTextures.getAtlasTextureRectByCellType(
+                        type
+                    ).left;
+                }
+
+                /* prevents the compiler to remove the lookups */
+                volatile int result = checksum;
+                static_cast<void>(result);
+            }
+        )
+    );
+
+    /* menu gradient */
+
+    const others::MenuGradient gradient(context);
+
+    results.push_back(
+        runBenchmark(
+            "menu_gradient_display",
+            DISPLAY_ITERATIONS,
+            [&gradient]()
+            {
+                gradient.display();
+            },
+            &window
+        )
+    );
+
+    /* whole animations, frame by frame, on the first floor */
+
+    context.restartClock();
+
+    animations::HorizontalMirrorAnimation horizontalMirror(
+        context,
+        level,
+        PERMUTED_FLOOR
+    );
+    results.push_back(
+        runAnimationBenchmark(
+            "animation_horizontal_mirror",
+            horizontalMirror,
+            window
+        )
+    );
+
+    animations::VerticalMirrorAnimation verticalMirror(
+        context,
+        level,
+        PERMUTED_FLOOR
+    );
+    results.push_back(
+        runAnimationBenchmark(
+            "animation_vertical_mirror",
+            verticalMirror,
+            window
+        )
+    );
+
+    animations::DiagonalAnimation diagonal(
+        context,
+        level,
+        PERMUTED_FLOOR
+    );
+    results.push_back(
+        runAnimationBenchmark(
+            "animation_diagonal",
+            diagonal,
+            window
+        )
+    );
+
+    animations::RotateFloorAnimation rotation(
+        context,
+        level,
+        PERMUTED_FLOOR,
+        animations::RotateFloorAnimation::MovementDirection::Left
+    );
+    results.push_back(
+        runAnimationBenchmark(
+            "animation_rotate_floor",
+            rotation,
+            window
+        )
+    );
+
+    window.close();
+
+    if (outputFilePath.empty())
+    {
+        writeResults(
+            std::cout,
+            levelFilePath,
+            results
+        );
+
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream file(outputFilePath);
+
+    if (not file.is_open())
+    {
+        std::cerr << outputFilePath << ": cannot be written" << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    writeResults(
+        file,
+        levelFilePath,
+        results
+    );
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,88 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file levelc.cpp
+ * @brief converts text level files into binary level files
+ * (memoris-levelc data/levels/official/1.level ...)
+ * @package tools
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "level_files.hpp"
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+
+/**
+ * @brief converts every given text level file into a binary level file
+ * with the same name and path; a file that cannot be converted stops
+ * the program with an error code, so the build fails
+ */
+int main(int argc, char* argv[])
+{
+    using namespace memoris;
+
+    const std::size_t extensionLength = std::strlen(
+        levels::TEXT_LEVEL_EXTENSION
+    );
+
+    for (int index {1}; index < argc; index += 1)
+    {
+        const std::string textFilePath = argv[index];
+
+        if (
+            textFilePath.size() <= extensionLength or
+            textFilePath.compare(
+                textFilePath.size() - extensionLength,
+                extensionLength,
+                levels::TEXT_LEVEL_EXTENSION
+            ) != 0
+        )
+        {
+            std::cerr << textFilePath << ": not a text level file"
+                << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        const std::string binaryFilePath =
+            textFilePath.substr(0, textFilePath.size() - extensionLength) +
+            levels::BINARY_LEVEL_EXTENSION;
+
+        try
+        {
+            levels::writeBinaryLevelFile(
+                binaryFilePath,
+                levels::loadTextLevelFile(textFilePath)
+            );
+        }
+        catch(std::invalid_argument& exception)
+        {
+            std::cerr << textFilePath << ": " << exception.what()
+                << std::endl;
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,74 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * @file pack.cpp
+ * @brief writes every given resource into one resources pack
+ * (memoris-pack res/resources.pack res images/star.png fonts/hi.otf ...)
+ * @package tools
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "resource_pack.hpp"
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+/**
+ * @brief writes the pack with the given path from the given resources;
+ * the resources names are their paths into the resources directory; a
+ * resource that cannot be packed stops the program with an error code,
+ * so the build fails
+ */
+int main(int argc, char* argv[])
+{
+    using namespace memoris;
+
+    constexpr int FIRST_RESOURCE_ARGUMENT {3};
+    if (argc < FIRST_RESOURCE_ARGUMENT)
+    {
+        std::cerr << "usage: memoris-pack <pack> <directory> <resources...>"
+            << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    const std::vector<std::string> names(
+        argv + FIRST_RESOURCE_ARGUMENT,
+        argv + argc
+    );
+
+    try
+    {
+        resources::writeResourcePack(
+            argv[1],
+            argv[2],
+            names
+        );
+    }
+    catch(std::invalid_argument& exception)
+    {
+        std::cerr << argv[1] << ": " << exception.what() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
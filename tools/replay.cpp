@@ -0,0 +1,120 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file replay.cpp
+ * @brief plays replay files without any window, as fast as possible
+ * (memoris-replay data/replays/last.replay ...)
+ * @package tools
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "replays.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <cstdlib>
+
+namespace
+{
+
+/**
+ * @brief returns the displayed name of a game status
+ *
+ * @param status the status to display
+ *
+ * @return const char*
+ */
+const char* getStatusName(const memoris::game::Status& status) noexcept
+{
+    using memoris::game::Status;
+
+    switch(status)
+    {
+    case Status::Won:
+    {
+        return "won";
+    }
+    case Status::Lost:
+    {
+        return "lost";
+    }
+    default:
+    {
+        return "playing";
+    }
+    }
+}
+
+}
+
+/**
+ * @brief plays every given replay file and checks that the game ends
+ * exactly like when it was recorded; a different end stops the program
+ * with an error code
+ */
+int main(int argc, char* argv[])
+{
+    using namespace memoris;
+
+    bool allReplaysMatch {true};
+
+    for (int index {1}; index < argc; index += 1)
+    {
+        const std::string filePath = argv[index];
+
+        replays::Replay replay;
+
+        try
+        {
+            replay = replays::loadReplayFile(filePath);
+        }
+        catch(std::invalid_argument& exception)
+        {
+            std::cerr << filePath << ": " << exception.what() << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
+        const auto state = replays::playReplay(replay);
+
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start
+            ).count();
+
+        const bool matches = state.status == replay.status;
+
+        std::cout << filePath << ": " << getStatusName(state.status)
+            << " (recorded " << getStatusName(replay.status) << "), "
+            << replay.steps.size() << " steps, "
+            << state.playingTime << " seconds played, "
+            << elapsed << " us" << std::endl;
+
+        if (not matches)
+        {
+            allReplaysMatch = false;
+        }
+    }
+
+    return allReplaysMatch ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,991 @@
+/*
+ * Memoris
+ * Copyright (C) 2017  Jean LELIEVRE
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file solver.cpp
+ * @brief searches the shortest solution of every given level file
+ * (memoris-solver data/levels/officials/a.level ...); the program fails if
+ * one level cannot be won
+ * @package tools
+ * @author Jean LELIEVRE <Jean.LELIEVRE@supinfo.com>
+ */
+
+#include "game_state.hpp"
+#include "level_files.hpp"
+#include "cells.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <array>
+#include <unordered_set>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+using namespace memoris;
+
+/* the first level of a serie is played without any life, this is the
+   worst case for the levels containing less life cells */
+constexpr unsigned short INITIAL_LIFES {0};
+
+constexpr unsigned short ORIENTATIONS_AMOUNT {16};
+constexpr unsigned short ORIENTATION_BITS {4};
+constexpr unsigned short TRANSFORMATIONS_AMOUNT {5};
+constexpr unsigned short MAXIMUM_SPECIAL_CELLS {128};
+constexpr unsigned short MAXIMUM_COUNTER {63};
+
+constexpr unsigned short PLAYER_SHIFT {40};
+constexpr unsigned short LIFES_SHIFT {52};
+constexpr unsigned short FOUND_STARS_SHIFT {58};
+constexpr std::uint64_t PLAYER_MASK {0xFFF};
+constexpr std::uint64_t ORIENTATIONS_MASK {(1ULL << PLAYER_SHIFT) - 1};
+
+constexpr std::size_t VISITED_SHARDS {64};
+constexpr std::size_t MAXIMUM_EXPLORED_NODES {4000000};
+constexpr std::size_t FRONTIER_CHUNK {256};
+
+/* duration of the animations, the timer keeps running when they are
+   rendered; the movements themselves are considered instantaneous */
+constexpr unsigned int MIRROR_ANIMATION_DURATION {1700};
+constexpr unsigned int DIAGONAL_ANIMATION_DURATION {1200};
+constexpr unsigned int ROTATION_ANIMATION_DURATION {950};
+constexpr unsigned int STAIRS_ANIMATION_DURATION {2100};
+
+constexpr game::Action MOVEMENTS[] {
+    game::Action::Up,
+    game::Action::Down,
+    game::Action::Left,
+    game::Action::Right
+};
+
+/**
+ * @brief the orientation of one floor is one of the sixteen combinations
+ * of the mirrors, the diagonal and the rotations; for each orientation,
+ * the tables give the current position of every original floor cell, the
+ * original cell of every current position, and the orientation obtained
+ * after every transformation
+ */
+struct Orientations
+{
+    std::array<std::array<unsigned char, dimensions::CELLS_PER_FLOOR>,
+        ORIENTATIONS_AMOUNT> positions;
+
+    std::array<std::array<unsigned char, dimensions::CELLS_PER_FLOOR>,
+        ORIENTATIONS_AMOUNT> originals;
+
+    std::array<std::array<unsigned char, TRANSFORMATIONS_AMOUNT>,
+        ORIENTATIONS_AMOUNT> next;
+};
+
+/**
+ * @brief compact search node: the cells are not stored, they are
+ * rebuilt from the initial level, the floors orientations and the
+ * removed special cells
+ */
+struct Node
+{
+    std::array<std::uint64_t, MAXIMUM_SPECIAL_CELLS / 64> removedCells;
+
+    /* 10 orientations of 4 bits, the player index on 12 bits,
+       the lifes and the found stars on 6 bits each */
+    std::uint64_t packed;
+
+    bool operator==(const Node& other) const noexcept
+    {
+        return removedCells == other.removedCells and packed == other.packed;
+    }
+};
+
+struct NodeHash
+{
+    std::size_t operator()(const Node& node) const noexcept
+    {
+        std::uint64_t hash = node.packed * 0x9E3779B97F4A7C15ULL;
+
+        for (const auto& bits : node.removedCells)
+        {
+            hash ^= bits + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+        }
+
+        return static_cast<std::size_t>(hash ^ (hash >> 32));
+    }
+};
+
+/**
+ * @brief the visited nodes; the set is split into shards with their own
+ * mutex, so the workers rarely wait for each other
+ */
+struct VisitedNodes
+{
+    std::array<std::unordered_set<Node, NodeHash>, VISITED_SHARDS> shards;
+
+    std::array<std::mutex, VISITED_SHARDS> mutexes;
+
+    bool insert(const Node& node) noexcept
+    {
+        const std::size_t shard = NodeHash()(node) % VISITED_SHARDS;
+
+        std::lock_guard<std::mutex> lock(mutexes[shard]);
+
+        return shards[shard].insert(node).second;
+    }
+};
+
+struct SearchNode
+{
+    Node node;
+    unsigned int animationsTime;
+};
+
+enum class SolutionType
+{
+    /* the shortest solution has been found */
+    Shortest,
+
+    /* the search limit has been reached, a solution has been found by
+       searching the nearest star again and again */
+    Found,
+
+    /* every reachable state has been explored */
+    Impossible,
+
+    /* the search limit has been reached and no solution has been found */
+    Unknown,
+
+    TooManySpecialCells
+};
+
+struct Solution
+{
+    SolutionType type {SolutionType::Unknown};
+    unsigned int moves {0};
+    unsigned int animationsTime {0};
+    std::size_t exploredNodes {0};
+};
+
+/**
+ * @brief the result of one breadth first search
+ */
+struct SearchResult
+{
+    bool found {false};
+    bool aborted {false};
+    bool won {false};
+    SearchNode goal;
+    unsigned int moves {0};
+    std::size_t exploredNodes {0};
+};
+
+/**
+ *
+ */
+Orientations createOrientations() noexcept
+{
+    Orientations orientations;
+
+    std::vector<std::array<unsigned char, dimensions::CELLS_PER_FLOOR>> found;
+
+    std::array<unsigned char, dimensions::CELLS_PER_FLOOR> identity;
+    for (unsigned short index {0}; index < identity.size(); index += 1)
+    {
+        identity[index] = static_cast<unsigned char>(index);
+    }
+
+    found.push_back(identity);
+
+    /* closure of the transformations group from the original orientation */
+    for (std::size_t current {0}; current < found.size(); current += 1)
+    {
+        for (
+            unsigned short transformation {0};
+            transformation < TRANSFORMATIONS_AMOUNT;
+            transformation += 1
+        )
+        {
+            std::array<unsigned char, dimensions::CELLS_PER_FLOOR> positions;
+
+            for (unsigned short index {0}; index < positions.size(); index += 1)
+            {
+                positions[index] = static_cast<unsigned char>(
+                    game::getTransformedFloorIndex(
+                        static_cast<game::Transformation>(transformation),
+                        found[current][index]
+                    )
+                );
+            }
+
+            auto iterator = std::find(
+                found.cbegin(),
+                found.cend(),
+                positions
+            );
+
+            if (iterator == found.cend())
+            {
+                found.push_back(positions);
+                iterator = found.cend() - 1;
+            }
+
+            orientations.next[current][transformation] =
+                static_cast<unsigned char>(iterator - found.cbegin());
+        }
+    }
+
+    for (std::size_t current {0}; current < found.size(); current += 1)
+    {
+        orientations.positions[current] = found[current];
+
+        for (unsigned short index {0}; index < identity.size(); index += 1)
+        {
+            orientations.originals[current][found[current][index]] =
+                static_cast<unsigned char>(index);
+        }
+    }
+
+    return orientations;
+}
+
+/**
+ * @brief solves one level with a breadth first search; every depth of
+ * the search is explored by all the workers, which take the nodes to
+ * expand by chunks from a shared counter, so a worker that finishes early
+ * takes the remaining work of the others
+ */
+class Solver
+{
+
+public:
+
+    Solver(
+        const levels::LevelData& data,
+        const Orientations& orientations
+    ) :
+        data(data),
+        orientations(orientations),
+        initialState(
+            game::createGameState(
+                data,
+                INITIAL_LIFES,
+                0,
+                false
+            )
+        )
+    {
+        specialCellsIndices.fill(-1);
+    }
+
+    Solution solve() &
+    {
+        Solution solution;
+
+        if (not indexSpecialCells())
+        {
+            solution.type = SolutionType::TooManySpecialCells;
+
+            return solution;
+        }
+
+        const SearchNode start {createNode(initialState), 0};
+
+        const auto shortest = search(
+            start,
+            false
+        );
+
+        solution.exploredNodes = shortest.exploredNodes;
+
+        if (shortest.found)
+        {
+            solution.type = SolutionType::Shortest;
+            solution.moves = shortest.moves;
+            solution.animationsTime = shortest.goal.animationsTime;
+
+            return solution;
+        }
+
+        if (not shortest.aborted)
+        {
+            solution.type = SolutionType::Impossible;
+
+            return solution;
+        }
+
+        /* the whole states space is too large to be explored (one state for
+           every combination of found stars and lifes); the level is solved
+           by going to the nearest star until the arrival is reachable,
+           the solution is not the shortest one */
+        SearchNode current = start;
+
+        while (true)
+        {
+            const auto nearest = search(
+                current,
+                true
+            );
+
+            solution.exploredNodes += nearest.exploredNodes;
+
+            if (not nearest.found)
+            {
+                solution.type = SolutionType::Unknown;
+
+                return solution;
+            }
+
+            solution.moves += nearest.moves;
+            current = nearest.goal;
+
+            if (nearest.won)
+            {
+                solution.type = SolutionType::Found;
+                solution.animationsTime = current.animationsTime;
+
+                return solution;
+            }
+        }
+    }
+
+private:
+
+    /**
+     * @brief the data shared by the workers during one search
+     */
+    struct Search
+    {
+        Search(
+            VisitedNodes& visited,
+            const unsigned short& initialFoundStars,
+            const bool& nearestStar
+        ) :
+            visited(visited),
+            initialFoundStars(initialFoundStars),
+            nearestStar(nearestStar)
+        {
+        }
+
+        VisitedNodes& visited;
+
+        const unsigned short initialFoundStars;
+        const bool nearestStar;
+
+        std::atomic<bool> found {false};
+        std::atomic<bool> aborted {false};
+        std::atomic<std::size_t> exploredNodes {1};
+
+        std::mutex goalMutex;
+        SearchNode goal;
+        bool won {false};
+    };
+
+    /**
+     * @brief gives one bit to every cell of the initial level that can be
+     * removed and that has an effect on the game; the time cells are
+     * ignored, they have no effect on the level result
+     */
+    bool indexSpecialCells() &
+    {
+        unsigned short specialCellsAmount {0};
+
+        for (
+            unsigned short index {0};
+            index < dimensions::CELLS_PER_LEVEL;
+            index += 1
+        )
+        {
+            switch(data.cells[index])
+            {
+            case cells::STAR_CELL:
+            case cells::MORE_LIFE_CELL:
+            case cells::LESS_LIFE_CELL:
+            case cells::HORIZONTAL_MIRROR_CELL:
+            case cells::VERTICAL_MIRROR_CELL:
+            case cells::DIAGONAL_CELL:
+            case cells::LEFT_ROTATION_CELL:
+            case cells::RIGHT_ROTATION_CELL:
+            case cells::ELEVATOR_UP_CELL:
+            case cells::ELEVATOR_DOWN_CELL:
+            {
+                if (specialCellsAmount == MAXIMUM_SPECIAL_CELLS)
+                {
+                    return false;
+                }
+
+                specialCellsIndices[index] = specialCellsAmount;
+                specialCellsAmount += 1;
+
+                break;
+            }
+            }
+        }
+
+        return data.starsAmount <= MAXIMUM_COUNTER;
+    }
+
+    /**
+     * @brief returns the orientation of the given floor
+     */
+    unsigned short getOrientation(
+        const Node& node,
+        const unsigned short& floor
+    ) const & noexcept
+    {
+        return (node.packed >> (floor * ORIENTATION_BITS)) &
+            (ORIENTATIONS_AMOUNT - 1);
+    }
+
+    /**
+     * @brief updates the orientation of the given floor
+     */
+    void setOrientation(
+        Node& node,
+        const unsigned short& floor,
+        const unsigned short& orientation
+    ) const & noexcept
+    {
+        const unsigned short shift = floor * ORIENTATION_BITS;
+
+        node.packed &= ~(
+            static_cast<std::uint64_t>(ORIENTATIONS_AMOUNT - 1) << shift
+        );
+        node.packed |= static_cast<std::uint64_t>(orientation) << shift;
+    }
+
+    /**
+     * @brief creates the node of the initial state (original orientations,
+     * no removed cell)
+     */
+    Node createNode(const game::GameState& state) const & noexcept
+    {
+        Node node;
+        node.removedCells.fill(0);
+        node.packed = 0;
+
+        updateCounters(
+            node,
+            state
+        );
+
+        return node;
+    }
+
+    /**
+     * @brief copies the player index, the lifes and the found stars
+     * of the state into the node
+     */
+    void updateCounters(
+        Node& node,
+        const game::GameState& state
+    ) const & noexcept
+    {
+        const std::uint64_t lifes = std::min(
+            state.lifes,
+            MAXIMUM_COUNTER
+        );
+
+        node.packed = (node.packed & ORIENTATIONS_MASK) |
+            (static_cast<std::uint64_t>(state.playerIndex) << PLAYER_SHIFT) |
+            (lifes << LIFES_SHIFT) |
+            (static_cast<std::uint64_t>(state.foundStars) << FOUND_STARS_SHIFT);
+    }
+
+    /**
+     * @brief rebuilds the full game state of a node
+     */
+    game::GameState createState(const Node& node) const & noexcept
+    {
+        using namespace dimensions;
+
+        game::GameState state = initialState;
+
+        for (
+            unsigned short floor {0};
+            floor < game::FLOORS_PER_LEVEL;
+            floor += 1
+        )
+        {
+            const auto& positions =
+                orientations.positions[getOrientation(node, floor)];
+            const unsigned short firstIndex = floor * CELLS_PER_FLOOR;
+
+            for (unsigned short index {0}; index < CELLS_PER_FLOOR; index += 1)
+            {
+                state.cells[firstIndex + positions[index]] =
+                    data.cells[firstIndex + index];
+            }
+        }
+
+        for (unsigned short index {0}; index < CELLS_PER_LEVEL; index += 1)
+        {
+            const short& bit = specialCellsIndices[index];
+
+            if (
+                bit != -1 and
+                (node.removedCells[bit / 64] >> (bit % 64)) & 1
+            )
+            {
+                const unsigned short floor = index / CELLS_PER_FLOOR;
+                const unsigned short firstIndex = floor * CELLS_PER_FLOOR;
+
+                state.cells[
+                    firstIndex + orientations.positions[
+                        getOrientation(node, floor)
+                    ][index - firstIndex]
+                ] = cells::EMPTY_CELL;
+            }
+        }
+
+        state.playerIndex = (node.packed >> PLAYER_SHIFT) & PLAYER_MASK;
+        state.floor = state.playerIndex / CELLS_PER_FLOOR;
+        state.lifes = (node.packed >> LIFES_SHIFT) & MAXIMUM_COUNTER;
+        state.foundStars = (node.packed >> FOUND_STARS_SHIFT) & MAXIMUM_COUNTER;
+
+        return state;
+    }
+
+    /**
+     * @brief applies the transformation of the event on the floors
+     * orientations; returns the animation duration of the event
+     */
+    unsigned int applyEvent(
+        Node& node,
+        const game::Event& event,
+        const unsigned short& floor
+    ) const & noexcept
+    {
+        game::Transformation transformation;
+        unsigned int duration {MIRROR_ANIMATION_DURATION};
+
+        switch(event)
+        {
+        case game::Event::FloorUp:
+        case game::Event::FloorDown:
+        {
+            return STAIRS_ANIMATION_DURATION;
+        }
+        case game::Event::VerticalMirror:
+        {
+            setOrientation(
+                node,
+                floor,
+                orientations.next[getOrientation(node, floor)][
+                    static_cast<unsigned short>(
+                        game::Transformation::VerticalMirror
+                    )
+                ]
+            );
+
+            return MIRROR_ANIMATION_DURATION;
+        }
+        case game::Event::HorizontalMirror:
+        {
+            transformation = game::Transformation::HorizontalMirror;
+
+            break;
+        }
+        case game::Event::Diagonal:
+        {
+            transformation = game::Transformation::Diagonal;
+            duration = DIAGONAL_ANIMATION_DURATION;
+
+            break;
+        }
+        case game::Event::LeftRotation:
+        {
+            transformation = game::Transformation::LeftRotation;
+            duration = ROTATION_ANIMATION_DURATION;
+
+            break;
+        }
+        case game::Event::RightRotation:
+        {
+            transformation = game::Transformation::RightRotation;
+            duration = ROTATION_ANIMATION_DURATION;
+
+            break;
+        }
+        default:
+        {
+            return 0;
+        }
+        }
+
+        for (
+            unsigned short current {0};
+            current < game::FLOORS_PER_LEVEL;
+            current += 1
+        )
+        {
+            setOrientation(
+                node,
+                current,
+                orientations.next[getOrientation(node, current)][
+                    static_cast<unsigned short>(transformation)
+                ]
+            );
+        }
+
+        return duration;
+    }
+
+    /**
+     * @brief breadth first search from the given node to the first won
+     * state, or to the first state with one more found star
+     *
+     * @param start the first node
+     * @param nearestStar true if the search stops at the first found star
+     */
+    SearchResult search(
+        const SearchNode& start,
+        const bool& nearestStar
+    ) &
+    {
+        SearchResult result;
+
+        VisitedNodes visited;
+        visited.insert(start.node);
+
+        std::vector<SearchNode> frontier {start};
+
+        Search current {
+            visited,
+            createState(start.node).foundStars,
+            nearestStar
+        };
+
+        const unsigned int workersAmount = std::max(
+            std::thread::hardware_concurrency(),
+            1u
+        );
+
+        while (
+            not frontier.empty() and
+            not current.found and
+            not current.aborted
+        )
+        {
+            result.moves += 1;
+
+            std::vector<std::vector<SearchNode>> nextFrontiers(workersAmount);
+            std::atomic<std::size_t> nextChunk {0};
+            std::vector<std::thread> workers;
+
+            for (unsigned int worker {0}; worker < workersAmount; worker += 1)
+            {
+                workers.emplace_back(
+                    [this, &current, &frontier, &nextChunk, &nextFrontiers,
+                        worker]()
+                    {
+                        expandFrontier(
+                            current,
+                            frontier,
+                            nextChunk,
+                            nextFrontiers[worker]
+                        );
+                    }
+                );
+            }
+
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+
+            frontier.clear();
+
+            for (auto& nextFrontier : nextFrontiers)
+            {
+                frontier.insert(
+                    frontier.end(),
+                    nextFrontier.cbegin(),
+                    nextFrontier.cend()
+                );
+            }
+        }
+
+        result.found = current.found;
+        result.aborted = current.aborted;
+        result.goal = current.goal;
+        result.won = current.won;
+        result.exploredNodes = current.exploredNodes;
+
+        return result;
+    }
+
+    /**
+     * @brief returns true if the given state ends the current search
+     */
+    bool isGoal(
+        const Search& current,
+        const game::GameState& state
+    ) const & noexcept
+    {
+        return state.status == game::Status::Won or (
+            current.nearestStar and
+            state.foundStars > current.initialFoundStars
+        );
+    }
+
+    /**
+     * @brief expands chunks of the frontier until the whole frontier
+     * has been taken by the workers
+     */
+    void expandFrontier(
+        Search& current,
+        const std::vector<SearchNode>& frontier,
+        std::atomic<std::size_t>& nextChunk,
+        std::vector<SearchNode>& nextFrontier
+    ) &
+    {
+        using namespace dimensions;
+
+        while (not current.found and not current.aborted)
+        {
+            const std::size_t first = nextChunk.fetch_add(FRONTIER_CHUNK);
+
+            if (first >= frontier.size())
+            {
+                return;
+            }
+
+            const std::size_t last = std::min(
+                first + FRONTIER_CHUNK,
+                frontier.size()
+            );
+
+            for (std::size_t index = first; index < last; index += 1)
+            {
+                expandNode(
+                    current,
+                    frontier[index],
+                    nextFrontier
+                );
+            }
+        }
+    }
+
+    /**
+     * @brief tries the four movements from the given node
+     */
+    void expandNode(
+        Search& current,
+        const SearchNode& searchNode,
+        std::vector<SearchNode>& nextFrontier
+    ) &
+    {
+        using namespace dimensions;
+
+        const auto state = createState(searchNode.node);
+
+        for (const auto& movement : MOVEMENTS)
+        {
+            auto nextState = state;
+            const auto result = game::step(nextState, movement);
+
+            if (
+                not result.moved or
+                nextState.status == game::Status::Lost
+            )
+            {
+                continue;
+            }
+
+            Node node = searchNode.node;
+
+            if (result.leftCellEmptied)
+            {
+                const unsigned short floor =
+                    state.playerIndex / CELLS_PER_FLOOR;
+                const unsigned short firstIndex = floor * CELLS_PER_FLOOR;
+                const unsigned short original = firstIndex +
+                    orientations.originals[getOrientation(node, floor)][
+                        state.playerIndex - firstIndex
+                    ];
+
+                const short& bit = specialCellsIndices[original];
+
+                if (bit != -1)
+                {
+                    node.removedCells[bit / 64] |= 1ULL << (bit % 64);
+                }
+            }
+
+            const unsigned int animationsTime =
+                searchNode.animationsTime + applyEvent(
+                    node,
+                    result.event,
+                    state.floor
+                );
+
+            updateCounters(
+                node,
+                nextState
+            );
+
+            if (isGoal(current, nextState))
+            {
+                std::lock_guard<std::mutex> lock(current.goalMutex);
+
+                const bool won = nextState.status == game::Status::Won;
+
+                /* a won state is always prefered, then the shortest
+                   animations time at the same depth */
+                if (
+                    not current.found or
+                    (won and not current.won) or
+                    (
+                        won == current.won and
+                        animationsTime < current.goal.animationsTime
+                    )
+                )
+                {
+                    current.goal = {node, animationsTime};
+                    current.won = won;
+                }
+
+                current.found = true;
+
+                continue;
+            }
+
+            if (not current.visited.insert(node))
+            {
+                continue;
+            }
+
+            if (current.exploredNodes.fetch_add(1) == MAXIMUM_EXPLORED_NODES)
+            {
+                current.aborted = true;
+
+                return;
+            }
+
+            nextFrontier.push_back({node, animationsTime});
+        }
+    }
+
+    const levels::LevelData& data;
+    const Orientations& orientations;
+    const game::GameState initialState;
+
+    std::array<short, dimensions::CELLS_PER_LEVEL> specialCellsIndices;
+};
+
+/**
+ * @brief solves every given level file; prints the minimum moves amount
+ * (or the moves amount of the found solution if the level is too large to
+ * be fully explored) and the animations time of every level; fails if one
+ * level cannot be won
+ */
+int main(int argc, char* argv[])
+{
+    const Orientations orientations = createOrientations();
+
+    int status {EXIT_SUCCESS};
+
+    for (int index {1}; index < argc; index += 1)
+    {
+        const std::string filePath = argv[index];
+
+        levels::LevelData data;
+
+        try
+        {
+            data = levels::loadTextLevelFile(filePath);
+        }
+        catch(std::invalid_argument& exception)
+        {
+            std::cerr << filePath << ": " << exception.what() << std::endl;
+
+            status = EXIT_FAILURE;
+
+            continue;
+        }
+
+        Solver solver(
+            data,
+            orientations
+        );
+
+        const Solution solution = solver.solve();
+
+        switch(solution.type)
+        {
+        case SolutionType::TooManySpecialCells:
+        {
+            std::cerr << filePath << ": too many special cells" << std::endl;
+
+            status = EXIT_FAILURE;
+
+            continue;
+        }
+        case SolutionType::Impossible:
+        {
+            std::cout << filePath << ": cannot be won (" <<
+                solution.exploredNodes << " states)" << std::endl;
+
+            status = EXIT_FAILURE;
+
+            continue;
+        }
+        case SolutionType::Unknown:
+        {
+            std::cout << filePath << ": no solution found before the search "
+                "limit (" << solution.exploredNodes << " states)" << std::endl;
+
+            status = EXIT_FAILURE;
+
+            continue;
+        }
+        default:
+        {
+            break;
+        }
+        }
+
+        constexpr unsigned int MILLISECONDS_PER_SECOND {1000};
+        constexpr unsigned int SECONDS_PER_MINUTE {60};
+        const unsigned int limit = data.minutes * SECONDS_PER_MINUTE +
+            data.seconds;
+
+        const char* movesPrefix =
+            solution.type == SolutionType::Shortest ? "" : "at most ";
+
+        std::cout << filePath << ": " << movesPrefix << solution.moves <<
+            " moves, " <<
+            std::fixed << std::setprecision(1) <<
+            static_cast<float>(solution.animationsTime) /
+                MILLISECONDS_PER_SECOND <<
+            "s of animations, " << limit << "s allowed (" <<
+            solution.exploredNodes << " states)" << std::endl;
+
+        if (solution.animationsTime > limit * MILLISECONDS_PER_SECOND)
+        {
+            std::cout << filePath << ": cannot be won in time" << std::endl;
+
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}